@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:06:58 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:14:02 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "minishell.h"
+
+# define BENCH_BASELINE "bench/baseline.json"
+# define BENCH_TOLERANCE 50
+# define BENCH_ROUNDS 5
+# define BENCH_MAX 64
+
+typedef void	(*t_bench_fn)(void *ctx);
+
+typedef struct s_str_bench
+{
+	int		fn;
+	char	*a;
+	char	*b;
+	size_t	len;
+}	t_str_bench;
+
+typedef struct s_bench
+{
+	const char	*name;
+	long		ops;
+	double		ns_op;
+	double		allocs_op;
+}	t_bench;
+
+double	bench_now(void);
+void	bench_run(t_bench *b, t_bench_fn fn, void *ctx);
+int		bench_report(t_bench *runs, int argc, char **argv);
+int		bench_shell(t_shell *shell);
+
+#endif
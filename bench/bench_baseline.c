@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_baseline.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:06:58 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:14:02 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.h"
+#include <stdio.h>
+
+/**
+ * load_baseline - Reads the stored results, one benchmark per line
+ * @path: The baseline file
+ * @base: Receives the entries, names allocated
+ *
+ * Returns the number of entries, 0 when there is no baseline yet.
+ */
+static int	load_baseline(const char *path, t_bench *base)
+{
+	FILE	*file;
+	char	line[256];
+	char	name[64];
+	int		count;
+
+	count = 0;
+	file = fopen(path, "r");
+	if (!file)
+		return (0);
+	while (count < BENCH_MAX && fgets(line, sizeof(line), file))
+	{
+		if (sscanf(line, " \"%63[^\"]\": {\"ns_op\": %lf, \"allocs_op\": %lf}",
+				name, &base[count].ns_op, &base[count].allocs_op) != 3)
+			continue ;
+		base[count].name = strdup(name);
+		if (base[count].name)
+			count++;
+	}
+	fclose(file);
+	return (count);
+}
+
+static t_bench	*find_bench(t_bench *base, int count, const char *name)
+{
+	int	i;
+
+	i = 0;
+	while (i < count && strcmp(base[i].name, name) != 0)
+		i++;
+	if (i == count)
+		return (NULL);
+	return (&base[i]);
+}
+
+/**
+ * save_baseline - Stores new results, keeping those of other drivers
+ * @path: The baseline file
+ * @base: The stored entries, updated in place
+ * @count: Number of stored entries
+ * @runs: The new results, ending with a NULL name
+ *
+ * Returns 0 on success, 1 on failure.
+ */
+static int	save_baseline(const char *path, t_bench *base, int count,
+	t_bench *runs)
+{
+	FILE	*file;
+	t_bench	*old;
+	int		i;
+
+	i = -1;
+	while (runs[++i].name)
+	{
+		old = find_bench(base, count, runs[i].name);
+		if (!old && count == BENCH_MAX)
+			continue ;
+		if (!old)
+			old = &base[count++];
+		*old = runs[i];
+	}
+	file = fopen(path, "w");
+	if (!file)
+		return (perror(path), 1);
+	fprintf(file, "{\n");
+	i = -1;
+	while (++i < count)
+	{
+		fprintf(file, "  \"%s\": {\"ns_op\": %.1f, \"allocs_op\": %.2f}",
+			base[i].name, base[i].ns_op, base[i].allocs_op);
+		if (i < count - 1)
+			fputc(',', file);
+		fputc('\n', file);
+	}
+	fprintf(file, "}\n");
+	fclose(file);
+	printf("baseline written to %s\n", path);
+	return (0);
+}
+
+/**
+ * compare - Prints one result against its baseline
+ * @b: The result
+ * @old: The baseline entry, or NULL
+ *
+ * Timings depend on the machine and its load, so a slowdown past the
+ * tolerance (BENCH_TOLERANCE percent unless set in the environment) is
+ * only flagged. Allocation counts are deterministic, so any
+ * growth is a regression.
+ * Returns 1 for a regression, 0 otherwise.
+ */
+static int	compare(t_bench *b, t_bench *old)
+{
+	int	tolerance;
+	int	regressed;
+
+	printf("%-18s %8ld %12.1f %10.2f", b->name, b->ops, b->ns_op,
+		b->allocs_op);
+	if (!old)
+		return (printf("   (no baseline)\n"), 0);
+	tolerance = BENCH_TOLERANCE;
+	if (getenv("BENCH_TOLERANCE"))
+		tolerance = atoi(getenv("BENCH_TOLERANCE"));
+	regressed = (b->allocs_op > old->allocs_op + 0.005);
+	printf(" %+8.1f%% %+8.2f  ", (b->ns_op / old->ns_op - 1) * 100,
+		b->allocs_op - old->allocs_op);
+	if (regressed)
+		printf("REGRESSION\n");
+	else if (b->ns_op > old->ns_op * (100 + tolerance) / 100)
+		printf("slower\n");
+	else
+		printf("ok\n");
+	return (regressed);
+}
+
+/**
+ * bench_report - Prints the results and checks them against the baseline
+ * @runs: The results, ending with a NULL name
+ * @argc: Argument count of the driver
+ * @argv: --save stores the results as the new baseline
+ *
+ * The baseline file is BENCH_BASELINE unless set in the environment. It
+ * is written by make bench-baseline on the machine that compares against
+ * it, timings from another machine mean nothing here.
+ * Returns the exit status of the driver, 1 when allocations regressed.
+ */
+int	bench_report(t_bench *runs, int argc, char **argv)
+{
+	t_bench		base[BENCH_MAX];
+	const char	*path;
+	int			count;
+	int			failed;
+	int			i;
+
+	path = getenv("BENCH_BASELINE");
+	if (!path)
+		path = BENCH_BASELINE;
+	count = load_baseline(path, base);
+	if (argc > 1 && strcmp(argv[1], "--save") == 0)
+		return (save_baseline(path, base, count, runs));
+	printf("%-18s %8s %12s %10s %9s %8s\n", "benchmark", "ops", "ns/op",
+		"allocs/op", "time", "allocs");
+	failed = 0;
+	i = -1;
+	while (runs[++i].name)
+		failed |= compare(&runs[i], find_bench(base, count, runs[i].name));
+	if (failed)
+		fprintf(stderr, "\n*** allocs regressed against %s ***\n\n", path);
+	return (failed);
+}
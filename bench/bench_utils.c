@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:06:58 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:14:02 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.h"
+#include <stdio.h>
+#include <time.h>
+
+static long	g_allocs = 0;
+
+void	*__real_malloc(size_t size);
+
+/**
+ * __wrap_malloc - Counts the allocations of the shell code
+ * @size: Requested size
+ *
+ * The drivers are linked with -Wl,--wrap=malloc, so every malloc call
+ * of the shell objects lands here.
+ */
+void	*__wrap_malloc(size_t size)
+{
+	g_allocs++;
+	return (__real_malloc(size));
+}
+
+double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/**
+ * time_round - Runs one round of a benchmark
+ * @fn: One operation
+ * @ctx: Argument of the operation
+ * @ops: Number of operations in the round
+ *
+ * Returns the time per operation in nanoseconds.
+ */
+static double	time_round(t_bench_fn fn, void *ctx, long ops)
+{
+	double	start;
+	long	i;
+
+	start = bench_now();
+	i = 0;
+	while (i++ < ops)
+		fn(ctx);
+	return ((bench_now() - start) / ops);
+}
+
+/**
+ * bench_run - Times a benchmark and counts its allocations
+ * @b: The benchmark, its ops count set
+ * @fn: One operation
+ * @ctx: Argument of the operation
+ *
+ * A tenth of the ops is run first as a warm-up, the rest is split into up
+ * to BENCH_ROUNDS rounds and the fastest round is kept so that a single
+ * scheduler hiccup does not show up as a slowdown.
+ */
+void	bench_run(t_bench *b, t_bench_fn fn, void *ctx)
+{
+	double	ns_op;
+	long	allocs;
+	long	rounds;
+	long	per_round;
+	long	i;
+
+	i = 0;
+	while (i++ < b->ops / 10)
+		fn(ctx);
+	rounds = BENCH_ROUNDS;
+	if (b->ops < rounds)
+		rounds = b->ops;
+	per_round = b->ops / rounds;
+	b->ops = per_round * rounds;
+	b->ns_op = -1;
+	allocs = g_allocs;
+	while (rounds--)
+	{
+		ns_op = time_round(fn, ctx, per_round);
+		if (b->ns_op < 0 || ns_op < b->ns_op)
+			b->ns_op = ns_op;
+	}
+	b->allocs_op = (double)(g_allocs - allocs) / b->ops;
+}
+
+/**
+ * bench_shell - Sets up a shell context without a terminal
+ * @shell: The context to fill
+ *
+ * The environment is copied with a fixed PATH, so that path lookups
+ * cost the same on every machine.
+ * Returns 0 on success, -1 on failure.
+ */
+int	bench_shell(t_shell *shell)
+{
+	extern char	**environ;
+
+	ft_memset(shell, 0, sizeof(t_shell));
+	shell->env = init_env(environ, shell);
+	if (!shell->env)
+		return (-1);
+	update_env(shell, "PATH",
+		"/usr/local/sbin:/usr/local/bin:/usr/sbin:/usr/bin:/sbin:/bin");
+	shell->saved_stdin = -1;
+	shell->saved_stdout = -1;
+	return (0);
+}
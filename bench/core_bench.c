@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   core_bench.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:06:58 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:40:12 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.h"
+
+#define LINE "cat < in.txt | grep -v \"foo bar\" | sort -u >> out.txt"
+#define EXPAND_LINE "echo \"$HOME/x\" $USER 'lit $PATH' a${SHLVL}b \"$?\""
+#define HEREDOC_LINES 64
+
+static void	op_tokenize(void *ctx)
+{
+	t_token	*tokens;
+
+	(void)ctx;
+	tokens = tokenize_input(ft_strdup(LINE));
+	free_tokens_list(&tokens);
+}
+
+static void	op_expand(void *ctx)
+{
+	t_shell	*shell;
+
+	shell = ctx;
+	shell->tokens = tokenize_input(ft_strdup(EXPAND_LINE));
+	if (syntax_check(shell) == 0)
+		free_command(&shell->commands);
+}
+
+static void	op_search_path(void *ctx)
+{
+	search_path_for_exec("ls", ctx);
+}
+
+static void	op_env_get(void *ctx)
+{
+	get_env_value(ctx, "PATH");
+}
+
+static void	op_env_set(void *ctx)
+{
+	update_env(ctx, "BENCH_VAR", "some value");
+}
+
+static void	op_heredoc(void *ctx)
+{
+	static char	text[HEREDOC_LINES * 32 + 8];
+	t_redir		redir;
+	int			fds[2];
+	int			i;
+
+	if (!text[0])
+	{
+		i = 0;
+		while (i < HEREDOC_LINES)
+			ft_memcpy(text + i++ * 32, "a heredoc line of 32 bytes ....\n", 32);
+		ft_memcpy(text + HEREDOC_LINES * 32, "EOF\n", 5);
+	}
+	if (pipe(fds) == -1)
+		return ;
+	write(fds[1], text, HEREDOC_LINES * 32 + 4);
+	close(fds[1]);
+	dup2(fds[0], STDIN_FILENO);
+	close(fds[0]);
+	ft_memset(&redir, 0, sizeof(t_redir));
+	redir.file_or_del = "EOF";
+	redir.quoted = 1;
+	free(capture_heredoc(&redir, ctx));
+}
+
+static void	op_split(void *ctx)
+{
+	(void)ctx;
+	free(ft_split("/usr/local/sbin:/usr/local/bin:/usr/sbin:/usr/bin"
+			":/sbin:/bin:/opt/tools/bin:/home/user/.local/bin", ':'));
+}
+
+static void	op_strjoin(void *ctx)
+{
+	(void)ctx;
+	free(ft_strjoin("/usr/local/lib/minishell/", "some_command_name"));
+}
+
+static void	run_heredoc(t_bench *b, t_shell *shell)
+{
+	int	saved_in;
+	int	saved_out;
+	int	null_fd;
+
+	saved_in = dup(STDIN_FILENO);
+	saved_out = dup(STDOUT_FILENO);
+	null_fd = open("/dev/null", O_WRONLY);
+	dup2(null_fd, STDOUT_FILENO);
+	close(null_fd);
+	bench_run(b, op_heredoc, shell);
+	dup2(saved_in, STDIN_FILENO);
+	dup2(saved_out, STDOUT_FILENO);
+	close(saved_in);
+	close(saved_out);
+}
+
+int	main(int argc, char **argv)
+{
+	static t_bench	runs[] = {{"tokenize", 200000, 0, 0},
+	{"expand", 50000, 0, 0}, {"search_path", 20000, 0, 0},
+	{"env_get", 2000000, 0, 0}, {"env_set", 20000, 0, 0},
+	{"heredoc_64", 2000, 0, 0}, {"ft_split", 500000, 0, 0},
+	{"ft_strjoin", 2000000, 0, 0}, {NULL, 0, 0, 0}};
+	static t_bench_fn	fns[] = {op_tokenize, op_expand, op_search_path,
+		op_env_get, op_env_set, NULL, op_split, op_strjoin};
+	t_shell			shell;
+	int				i;
+
+	if (bench_shell(&shell))
+		return (1);
+	i = -1;
+	while (runs[++i].name)
+	{
+		if (fns[i])
+			bench_run(&runs[i], fns[i], &shell);
+		else
+			run_heredoc(&runs[i], &shell);
+	}
+	return (bench_report(runs, argc, argv));
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pattern_bench.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:34:17 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:09:13 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+#include <fnmatch.h>
+#include <stdio.h>
+#include <time.h>
+
+#define NAME_COUNT 200000
+#define ROUNDS 5
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static char	**make_names(void)
+{
+	static const char	*formats[] = {"file%d.c", "src_%d.h", "README%d",
+		"lib%d_utils.a", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa%db",
+		"Makefile.%d.bak"};
+	char				buffer[128];
+	char				**names;
+	int					i;
+
+	names = malloc(sizeof(char *) * NAME_COUNT);
+	if (!names)
+		return (NULL);
+	i = 0;
+	while (i < NAME_COUNT)
+	{
+		snprintf(buffer, sizeof(buffer), formats[i % 6], i);
+		names[i] = strdup(buffer);
+		if (!names[i++])
+			return (NULL);
+	}
+	return (names);
+}
+
+static int	run_fnmatch(const char *pattern, char **names, double *elapsed)
+{
+	double	start;
+	int		matches;
+	int		round;
+	int		i;
+
+	round = 0;
+	start = now_ns();
+	while (round++ < ROUNDS)
+	{
+		matches = 0;
+		i = 0;
+		while (i < NAME_COUNT)
+			matches += (fnmatch(pattern, names[i++], 0) == 0);
+	}
+	*elapsed = (now_ns() - start) / ((double)ROUNDS * NAME_COUNT);
+	return (matches);
+}
+
+static int	run_compiled(const char *pattern, char **names, double *elapsed)
+{
+	t_pattern	pat;
+	double		start;
+	int			matches;
+	int			round;
+	int			i;
+
+	round = 0;
+	start = now_ns();
+	if (pattern_compile(&pat, pattern))
+		return (-1);
+	while (round++ < ROUNDS)
+	{
+		matches = 0;
+		i = 0;
+		while (i < NAME_COUNT)
+		{
+			matches += pattern_match(&pat, names[i], strlen(names[i]));
+			i++;
+		}
+	}
+	pattern_free(&pat);
+	*elapsed = (now_ns() - start) / ((double)ROUNDS * NAME_COUNT);
+	return (matches);
+}
+
+int	main(void)
+{
+	static const char	*patterns[] = {"*.c", "file1*", "*_1?.h", "README",
+		"[a-f]*[0-9].c", "*a*a*a*a*b", "file[!0-4]*", "*util*", "*", NULL};
+	char				**names;
+	double				t_fn;
+	double				t_pat;
+	int					i;
+
+	names = make_names();
+	if (!names)
+		return (1);
+	printf("%-16s %10s %10s %10s %8s\n", "pattern", "matches", "fnmatch",
+		"compiled", "speedup");
+	i = -1;
+	while (patterns[++i])
+	{
+		if (run_fnmatch(patterns[i], names, &t_fn)
+			!= run_compiled(patterns[i], names, &t_pat))
+		{
+			fprintf(stderr, "pattern_bench: mismatch on %s\n", patterns[i]);
+			return (1);
+		}
+		printf("%-16s %10d %8.1fns %8.1fns %7.2fx\n", patterns[i],
+			run_compiled(patterns[i], names, &t_pat), t_fn, t_pat,
+			t_fn / t_pat);
+	}
+	return (0);
+}
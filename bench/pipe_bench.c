@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_bench.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:14:02 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:14:02 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.h"
+
+#define PIPE_BENCH_LINE "dd if=/dev/zero bs=1M count=4096 status=none \
+| dd of=/dev/null bs=1M status=none"
+
+static void	op_pipe(void *ctx)
+{
+	t_shell	*shell;
+
+	shell = ctx;
+	setup_pipeline_execution(shell, shell->commands);
+	if (g_exit_status != 0)
+		fprintf(stderr, "pipe_bench: pipeline failed (%d)\n", g_exit_status);
+}
+
+/**
+ * print_throughput - Prints the rate of each run in GiB/s
+ * @runs: The results, ending with a NULL name
+ *
+ * Every op moves 4 GiB from the producer to the consumer.
+ */
+static void	print_throughput(t_bench *runs)
+{
+	int	i;
+
+	i = -1;
+	while (runs[++i].name)
+		printf("%-18s %10.2f GiB/s\n", runs[i].name,
+			4.0 * 1e9 / runs[i].ns_op);
+}
+
+int	main(int argc, char **argv)
+{
+	static t_bench	runs[] = {{"pipe_4g_default", 1, 0, 0},
+	{"pipe_4g_1m", 1, 0, 0}, {NULL, 0, 0, 0}};
+	static long		sizes[] = {0, 1L << 20};
+	t_shell			shell;
+	int				i;
+	int				failed;
+
+	if (bench_shell(&shell))
+		return (1);
+	shell.tokens = tokenize_input(ft_strdup(PIPE_BENCH_LINE));
+	if (syntax_check(&shell) || !shell.commands)
+		return (fprintf(stderr, "pipe_bench: parse failed\n"), 1);
+	i = -1;
+	while (runs[++i].name)
+	{
+		shell.pipe_size = sizes[i];
+		bench_run(&runs[i], op_pipe, &shell);
+	}
+	free_command(&shell.commands);
+	failed = bench_report(runs, argc, argv);
+	print_throughput(runs);
+	return (failed);
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:06:58 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:18:30 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.h"
+
+#define SPAWN_LINEAR_BOUND 2.0
+#define SPAWN_HEAP_NODES 200000
+
+/**
+ * build_pipeline - Parses a pipeline of the same command repeated
+ * @shell: Shell context receiving the commands
+ * @stage: A 4-letter command name followed by " | "
+ * @stages: Number of stages
+ *
+ * The commands are parsed once and executed by every op, so only the
+ * spawn itself is measured.
+ * Returns 0 on success, -1 on failure.
+ */
+static int	build_pipeline(t_shell *shell, const char *stage, int stages)
+{
+	char	*line;
+	int		i;
+
+	line = malloc(stages * 7 + 1);
+	if (!line)
+		return (-1);
+	i = 0;
+	while (i < stages)
+	{
+		ft_memcpy(line + i * 7, stage, 7);
+		i++;
+	}
+	line[stages * 7 - 3] = '\0';
+	shell->tokens = tokenize_input(line);
+	if (syntax_check(shell) || !shell->commands)
+		return (-1);
+	return (0);
+}
+
+static void	op_spawn(void *ctx)
+{
+	t_shell	*shell;
+
+	shell = ctx;
+	setup_pipeline_execution(shell, shell->commands);
+	if (g_exit_status != 0)
+		fprintf(stderr, "spawn_bench: pipeline failed (%d)\n", g_exit_status);
+}
+
+/**
+ * pick_stage - Chooses the command repeated by a run
+ * @shell: Shell context whose managed list grows for builtin runs
+ * @run: The run about to be measured
+ *
+ * Builtin runs first fill the memory manager like a long interactive
+ * session: builtin stages fork this image, so their cost must not grow
+ * with it. jobs is used as it prints nothing here.
+ * Returns the stage text, or NULL when out of memory.
+ */
+static const char	*pick_stage(t_shell *shell, t_bench *run)
+{
+	int	i;
+
+	if (ft_strncmp(run->name, "builtin", 7) != 0)
+		return ("true | ");
+	i = 0;
+	while (i++ < SPAWN_HEAP_NODES)
+		if (!allocate_managed_memory(&shell->memory_manager, 32,
+				MEM_ERROR_RECOVERABLE, NULL))
+			return (NULL);
+	return ("jobs | ");
+}
+
+/**
+ * check_fork_rate - Checks that pipeline setup scales linearly
+ * @runs: The results, ending with a NULL name
+ * @stages: Number of stages of each result
+ *
+ * The cost per stage of the longest pipelines may not exceed
+ * SPAWN_LINEAR_BOUND times the one of the 16-stage pipeline.
+ * Returns 1 when the bound is exceeded, 0 otherwise.
+ */
+static int	check_fork_rate(t_bench *runs, int *stages)
+{
+	double	base;
+	double	per_stage;
+	int		failed;
+	int		i;
+
+	base = runs[1].ns_op / stages[1];
+	failed = 0;
+	i = -1;
+	while (runs[++i].name)
+	{
+		per_stage = runs[i].ns_op / stages[i];
+		printf("%-18s %10.1f us/stage %10.0f forks/s\n", runs[i].name,
+			per_stage / 1000, 1e9 / per_stage);
+		if (stages[i] >= 1000 && per_stage > base * SPAWN_LINEAR_BOUND)
+			failed = 1;
+	}
+	if (failed)
+		fprintf(stderr, "\n*** pipeline setup is not linear in the number "
+			"of stages ***\n\n");
+	return (failed);
+}
+
+int	main(int argc, char **argv)
+{
+	static t_bench	runs[] = {{"spawn_2", 200, 0, 0}, {"spawn_16", 40, 0, 0},
+	{"spawn_256", 4, 0, 0}, {"spawn_1000", 3, 0, 0},
+	{"spawn_1024", 2, 0, 0}, {"spawn_5000", 1, 0, 0},
+	{"builtin_16_heap", 40, 0, 0}, {NULL, 0, 0, 0}};
+	static int		stages[] = {2, 16, 256, 1000, 1024, 5000, 16};
+	t_shell			shell;
+	const char		*stage;
+	int				i;
+	int				failed;
+
+	if (bench_shell(&shell))
+		return (1);
+	i = -1;
+	while (runs[++i].name)
+	{
+		stage = pick_stage(&shell, &runs[i]);
+		if (!stage || build_pipeline(&shell, stage, stages[i]))
+			return (fprintf(stderr, "spawn_bench: parse failed\n"), 1);
+		bench_run(&runs[i], op_spawn, &shell);
+		free_command(&shell.commands);
+	}
+	failed = bench_report(runs, argc, argv);
+	return (check_fork_rate(runs, stages) | failed);
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   string_bench.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:21:28 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:33:26 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "bench.h"
+
+#define STR_CHECK_MAX 600
+#define STR_PAGE 4096
+
+static t_bench	g_runs[] = {{"strlen_8", 0, 0, 0}, {"strlen_64", 0, 0, 0},
+	{"strlen_4k", 0, 0, 0}, {"strlen_1m", 0, 0, 0}, {"strchr_8", 0, 0, 0},
+	{"strchr_64", 0, 0, 0}, {"strchr_4k", 0, 0, 0}, {"strchr_1m", 0, 0, 0},
+	{"strcmp_8", 0, 0, 0}, {"strcmp_64", 0, 0, 0}, {"strcmp_4k", 0, 0, 0},
+	{"strcmp_1m", 0, 0, 0}, {"memcpy_8", 0, 0, 0}, {"memcpy_64", 0, 0, 0},
+	{"memcpy_4k", 0, 0, 0}, {"memcpy_1m", 0, 0, 0}, {"memset_8", 0, 0, 0},
+	{"memset_64", 0, 0, 0}, {"memset_4k", 0, 0, 0}, {"memset_1m", 0, 0, 0},
+	{NULL, 0, 0, 0}};
+
+/**
+ * check_scan - Checks ft_strlen and ft_strchr against libc
+ * @end: End of a readable page followed by an unreadable one
+ *
+ * Every string ends right before the unreadable page, so a read past
+ * the terminator that crosses into it crashes the check.
+ * Returns the number of mismatches.
+ */
+static int	check_scan(char *end)
+{
+	char	*s;
+	int		bad;
+	size_t	len;
+
+	bad = 0;
+	len = 0;
+	while (len < STR_CHECK_MAX)
+	{
+		s = end - len - 1;
+		memset(s, 'x', len);
+		s[len] = '\0';
+		bad += (ft_strlen(s) != strlen(s));
+		bad += (ft_strchr(s, 'y') != NULL);
+		bad += (ft_strchr(s, '\0') != s + len);
+		if (len)
+			s[len / 2] = 'y';
+		bad += (ft_strchr(s, 'y') != strchr(s, 'y'));
+		bad += (ft_strchr(s, 'x') != strchr(s, 'x'));
+		len++;
+	}
+	return (bad);
+}
+
+/**
+ * check_compare - Checks ft_strcmp and ft_strncmp against libc
+ * @end_a: End of the first guarded page
+ * @end_b: End of the second guarded page
+ *
+ * Both strings end before an unreadable page and differ at every
+ * position in turn, in both directions.
+ * Returns the number of mismatches.
+ */
+static int	check_compare(char *end_a, char *end_b)
+{
+	char	*a;
+	char	*b;
+	int		bad;
+	size_t	len;
+	size_t	i;
+
+	bad = 0;
+	len = 0;
+	while (len++ < STR_CHECK_MAX)
+	{
+		a = memset(end_a - len, 'x', len);
+		a[len - 1] = '\0';
+		b = memcpy(end_b - len, a, len);
+		bad += (ft_strcmp(a, b) != 0 || ft_strncmp(a, b, len + 8) != 0);
+		i = 0;
+		while (i + 1 < len)
+		{
+			b[i] = "yw"[i & 1];
+			bad += ((ft_strcmp(a, b) < 0) != (strcmp(a, b) < 0));
+			bad += (ft_strncmp(a, b, i) != 0);
+			bad += ((ft_strncmp(b, a, i + 1) > 0) != (strcmp(b, a) > 0));
+			b[i++] = 'x';
+		}
+	}
+	return (bad);
+}
+
+/**
+ * check_copy - Checks ft_memcpy and ft_memset against libc
+ * @end_a: End of the first guarded page
+ * @end_b: End of the second guarded page
+ *
+ * The bytes in front of each area must stay untouched.
+ * Returns the number of mismatches.
+ */
+static int	check_copy(char *end_a, char *end_b)
+{
+	char	*a;
+	char	*b;
+	int		bad;
+	size_t	len;
+	size_t	i;
+
+	bad = 0;
+	len = 0;
+	while (len < STR_CHECK_MAX)
+	{
+		a = end_a - len;
+		b = end_b - len;
+		i = 0;
+		while (i++ < len)
+			a[i - 1] = (char)(i * 7);
+		b[-1] = 'g';
+		bad += (ft_memcpy(b, a, len) != b || memcmp(a, b, len) != 0);
+		bad += (ft_memset(b, 'z', len) != b || b[-1] != 'g');
+		while (i-- > 1)
+			bad += (b[i - 1] != 'z');
+		len++;
+	}
+	return (bad);
+}
+
+static void	op_string(void *ctx)
+{
+	t_str_bench	*c;
+
+	c = ctx;
+	if (c->fn / 4 == 0)
+		ft_strlen(c->a);
+	else if (c->fn / 4 == 1)
+		ft_strchr(c->a, 'y');
+	else if (c->fn / 4 == 2)
+		ft_strcmp(c->a, c->b);
+	else if (c->fn / 4 == 3)
+		ft_memcpy(c->b, c->a, c->len);
+	else
+		ft_memset(c->b, 'z', c->len);
+}
+
+int	main(int argc, char **argv)
+{
+	static size_t	sizes[] = {8, 64, 4096, 1 << 20};
+	t_str_bench		c;
+
+	c.a = mmap(NULL, 4 * STR_PAGE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (c.a == MAP_FAILED || mprotect(c.a + STR_PAGE, STR_PAGE, PROT_NONE)
+		|| mprotect(c.a + 3 * STR_PAGE, STR_PAGE, PROT_NONE))
+		return (perror("string_bench"), 1);
+	if (check_scan(c.a + STR_PAGE)
+		|| check_compare(c.a + STR_PAGE, c.a + 3 * STR_PAGE)
+		|| check_copy(c.a + STR_PAGE, c.a + 3 * STR_PAGE))
+		return (fprintf(stderr, "string_bench: differs from libc\n"), 1);
+	c.a = ft_calloc(2, (1 << 20) + 1);
+	c.b = c.a + (1 << 20) + 1;
+	c.fn = -1;
+	while (c.a && g_runs[++c.fn].name)
+	{
+		c.len = sizes[c.fn % 4];
+		((char *)ft_memset(c.a, 'x', c.len))[c.len] = '\0';
+		ft_memcpy(c.b, c.a, c.len + 1);
+		g_runs[c.fn].ops = (64 << 20) / c.len + 100;
+		bench_run(&g_runs[c.fn], op_string, &c);
+	}
+	return (bench_report(g_runs, argc, argv));
+}
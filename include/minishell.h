@@ -1,413 +1,924 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   minishell.h                                        :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/05/11 02:38:31 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 20:00:45 by hchowdhu         ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#ifndef MINISHELL_H
-# define MINISHELL_H
-
-# include <stdio.h>
-# include <stdlib.h>
-# include <unistd.h>
-# include <fcntl.h>
-# include <sys/wait.h>
-# include <signal.h>
-# include <readline/readline.h>
-# include <readline/history.h>
-# include <errno.h>
-# include <string.h>
-# include <sys/stat.h>
-# include <termios.h>
-# include <limits.h>
-# include <sys/ioctl.h>
-# include <termios.h>
-# include <stdint.h> 
-
-# define PROMPT_SIZE 256
-# define OPEN_MAX 1024
-
-// Text colors
-# define BLACK "\033[0;30m"
-# define RED "\033[0;31m"
-# define GREEN "\033[0;32m"
-# define YELLOW "\033[0;33m"
-# define BLUE "\033[0;34m"
-# define PURPLE "\033[0;35m"
-# define CYAN "\033[0;36m"
-# define WHITE "\033[0;37m"
-
-// Bold text colors
-# define BOLD_BLACK "\033[1;30m"
-# define BOLD_RED "\033[1;31m"
-# define BOLD_GREEN "\033[1;32m"
-# define BOLD_YELLOW "\033[1;33m"
-# define BOLD_BLUE "\033[1;34m"
-# define BOLD_PURPLE "\033[1;35m"
-# define BOLD_CYAN "\033[1;36m"
-# define BOLD_WHITE "\033[1;37m"
-# define BOLD_RESET "\033[1;0m"
-# define BOLD_MAGENTA "\033[1;35m"
-# define RESET "\033[0m"
-
-# define ERROR_MALLOC "minishell: error: memory allocation failed\n"
-# define ERROR_ARGS "minishell: error: no arguments allowed\n"
-# define ERROR_QUOTES "minishell: syntax error: unclosed quote\n"
-# define ERROR_ENV_INIT "minishell: error: failed to initialize environment\n"
-# define ERROR_TOKENIZE "minishell: error: failed to create token list\n"
-# define ERROR_SYNTAX "minishell: syntax error near unexpected token"
-# define ERROR_SYNTAX_NL "minishell: syntax error near unexpected token \
-'newline'\n"
-# define ERROR_SYNTAX_PIPE "minishell: syntax error near unexpected token '|'"
-# define ERROR_HEREDOC_EOF "minishell: warning: here-document delimited \
-by end-of-file (wanted `"
-# define ERROR_UNSUPPORTED "minishell: error: unsupported character\n"
-# define ERROR_IDENTIFIER "minishell: error: not a valid identifier\n"
-# define MEM_ERROR_FATAL 1
-# define MEM_ERROR_RECOVERABLE 0
-# define BUFFER_SIZE 5
-
-extern int	g_exit_status;
-
-typedef struct s_memory_node
-{
-	void					*ptr;
-	int						cleanup_mode;
-	void					(*free_func)(void *);
-	struct s_memory_node	*next;
-}	t_memory_node;
-
-typedef enum e_token_type
-{
-	WORD,
-	PIPE,
-	REDIR_IN,
-	REDIR_OUT,
-	APPEND,
-	HEREDOC,
-	T_EOF,
-	ERROR,
-}	t_token_type;
-
-typedef struct s_token
-{
-	t_token_type	type;
-	char			*value;
-	int				single_quote;
-	int				double_quote;
-	int				space_before;
-	int				space_after;
-	int				ar;
-	int				quoted_outside;
-	struct s_token	*previous;
-	struct s_token	*next;
-}	t_token;
-
-typedef struct s_redir
-{
-	t_token_type	type;
-	char			*file_or_del;
-	char			*heredoc_content;
-	int				quoted;
-	int				quoted_outside;
-	int				ar;
-	struct s_redir	*next;
-}	t_redir;
-
-typedef struct s_char
-{
-	char	*line;
-	char	*str;
-	char	*new_line;
-}	t_char;
-
-typedef struct s_command
-{
-	char				**args;
-	t_redir				*redirs;
-	int					fd_in;
-	int					fd_out;
-	pid_t				pid;
-	struct s_command	*previous;
-	struct s_command	*next;
-}	t_command;
-
-typedef struct s_shell
-{
-	char				**env;
-	t_token				*tokens;
-	t_command			*commands;
-	t_memory_node		*memory_manager;
-	int					saved_stdin;
-	int					saved_stdout;
-	int					heredoc_interupt;
-	int					pipe_interupt;
-	int					path_was_unset;
-	int					pipe_count;
-	char				*default_path;
-}	t_shell;
-
-typedef struct s_pipe_data
-{
-	pid_t	*pids;
-	int		*fork_count;
-	pid_t	*last_pid;
-	int		*input_fd;
-}	t_pipe_data;
-
-		/*SIGNAL HANDLING FUNCTIONS*/
-
-void	setup_signals(void);
-void	handle_interrupt(int sig);
-void	reset_signals_to_default(void);
-int		safely_execute_command(t_shell *shell);
-void	disable_control_char_echo(void);
-void	enable_control_char_echo(void);
-void	handle_heredoc_interrupt(int sig);
-void	setup_heredoc_signal_handlers(struct sigaction *old_int, \
-	struct sigaction *old_quit);
-void	restore_signal_handlers(struct sigaction *old_int, \
-	struct sigaction *old_quit);
-void	restore_signals_clear_buffer(struct sigaction *old_int, \
-	struct sigaction *old_quit);
-void	display_heredoc_eof_warning(char *delim);
-void	restore_standard_fds(t_shell *shell);
-
-		/* BUILTIN FUNCTIONS */
-
-int		builtin_cd(t_shell *shell, t_command *cmd);
-int		builtin_echo(t_command *cmd);
-int		builtin_env(t_shell *shell, t_command *cmd);
-int		builtin_exit(t_shell *shell, t_command *cmd);
-int		builtin_export(t_shell *shell, t_command *cmd);
-int		builtin_pwd(t_shell *shell);
-int		builtin_unset(t_shell *shell, t_command *cmd);
-int		builtin_help(t_shell *shell);
-int		is_builtin(t_command *cmd);
-int		run_builtin(t_shell *shell, t_command *cmd);
-void	run_builtin_command(t_shell *shell, t_command *cmd);
-
-		/* EXECUTION FUNCTIONS */
-
-void	execute_non_piped_command(t_shell *shell, t_command *cmd);
-void	execute_command_sequence(t_shell *shell);
-void	ignore_sigint_and_wait(pid_t child_pid);
-void	setup_and_execute_child_process(t_shell *shell, t_command *cmd);
-void	execute_pipe(t_shell *shell, t_command *cmd, pid_t *pids);
-int		create_pipe_if_needed(t_command *cmd, int pipe_fds[2]);
-int		fork_pipe_child(t_shell *shell, t_command *cmd, \
-int input_fd, int pipe_fds[2]);
-char	*search_path_for_exec(char *cmd, t_shell *shell);
-char	*get_command_path(t_shell *shell, t_command *cmd);
-
-		/* ENVIRONMENT FUNCTIONS */
-
-char	**get_env(char **envp, t_shell *shell);
-char	*get_env_value(t_shell *shell, const char *var_name);
-char	**add_env_var(t_shell *shell, char *new_var);
-char	**init_env(char **envp, t_shell *shell);
-char	**init_minimal_env(void);
-int		env_error(const char *msg, t_memory_node **gc);
-int		duplicate_existing_vars(t_shell *shell, char **new_env, int size);
-int		add_to_env(t_shell *shell, char *new_var);
-int		find_var_pos(char *var_name, t_shell *shell);
-int		is_valid_identifier(const char *str);
-int		env_has_path(char **envp);
-void	sort_env_for_export(char **env_copy);
-void	update_env(t_shell *shell, char *var, char *new_value);
-
-		/*HEREDOC REDIRECT FUNCTIONS*/
-
-char	*capture_heredoc(t_redir *redirs, t_shell *data);
-int		setup_heredoc_pipe(t_command *cmd, t_redir *redir);
-char	*get_next_line(int fd, int clear);
-char	*read_and_store(char *buffer, int fd);
-char	*update_buffer(char *buffer);
-char	*extract_line(char *buffer);
-
-		/* PIPE EXECUTION FUNCTIONS */
-
-void	setup_pipeline_execution(t_shell *shell, t_command *cmd);
-char	*combine_command_arguments(t_shell *shell, char **args);
-int		process_single_piped_command(t_shell *shell, t_command *cmd,
-			t_pipe_data *data);
-void	collect_pipeline_exit_status(pid_t *pids, int count, pid_t last_pid);
-void	cleanup_finished_processes(pid_t *pids, int count);
-void	handle_pipe_child(t_shell *shell, t_command *cmd, int input_fd,
-			int pipe_fds[2]);
-
-		/* REDIRECTION FUNCTIONS */
-
-int		process_command_redirections(t_command *cmd, t_shell *shell);
-void	update_command_redirections(t_command *cmd, int type, int fd);
-int		report_file_error(const char *filename);
-int		open_file_for_input(const char *path);
-int		open_file_for_output(const char *path);
-int		open_file_for_append(const char *path);
-int		open_redir_file(t_redir *redir, t_command *cmd);
-void	setup_command_io(t_command *cmd, int input_fd, int pipe_fds[2]);
-void	setup_command_output(t_command *cmd, int pipe_fds[2]);
-void	setup_command_input(t_command *cmd, int input_fd);
-void	apply_command_redirections(t_command *cmd);
-
-	/* SHELL INITIALIZATION AND MANAGEMENT */
-
-void	init_shell_fds(t_shell *shell);
-int		is_shell_command(char *cmd);
-int		is_fd_writable(int fd, const char *cmd_name);
-void	clean_and_exit_shell(t_shell *shell, int exit_code);
-void	update_shell_lvl(t_shell *shell);
-void	cleanup_shell_file_descriptors(t_shell *shell);
-void	error(const char *cmd, const char *error_item, const char *msg);
-void	error_quoted(const char *cmd, const char *error_item, const char *msg);
-void	display_error_and_exit(t_shell *shell, const char *cmd, const char *msg,
-			int exit_code);
-void	close_all_non_standard_fds(void);
-void	close_unused_command_fds(t_command *all_cmds, t_command *current_cmd);
-
-	/* MEMORY MANAGEMENT FUNCTIONS */
-
-char	*managed_string_copy(t_memory_node \
-	**memory_manager, const char *s1);
-char	*join_managed_strings(t_memory_node **memory_manager, const char *s1, \
-	const char *s2);
-char	*gc_itoa(t_memory_node **memory_manager, int n);
-int		track_memory_allocation(t_memory_node **memory_manager, \
-	void *ptr, int cleanup_mode, \
-	void (*free_func)(void *));
-void	release_all_memory(t_memory_node **memory_manager);
-void	*allocate_managed_memory(t_memory_node **memory_manager, \
-	size_t size, int cleanup_mode, void (*free_func)(void *));
-void	free_array(void *ptr);
-void	free_redirs(t_redir **redirs);
-void	free_command(t_command **cmd);
-void	free_tokens_list(t_token **head);
-
-		/* TOKENIZATION AND SYNTAX CHECKING FUNCTIONS */
-
-t_token	*tokenize_input(char *input);
-t_token	*create_token(t_token_type type, char *value);
-int		handle_in_quote(int start_quote, char *input, int *i, t_token **tokens);
-int		handle_double_operator(int *i, t_token **tokens,
-			t_token_type operator);
-int		handle_single_operator(int *i, t_token **tokens,
-			t_token_type operator);
-int		is_operator(char *str, int i);
-int		is_whitespace(char c);
-int		is_quote(char c);
-void	add_token(t_token **head, t_token *new_token);
-int		is_whitespace_bis(char *str);
-void	restore_signals_clear_buffer(struct sigaction *old_int,
-			struct sigaction *old_quit);
-int		syntax_check(t_shell *cmd);
-int		add_token_error(t_token **tokens, t_token *token, char *str);
-int		is_token_operator(t_token_type token_type);
-int		is_operator_follow(t_token **tokens, t_token *current_token);
-int		check_unsupported_character(t_token **tokens);
-int		check_token_error(t_token **tokens);
-int		check_unsupported_character(t_token **tokens);
-
-		/* COMMAND AND ARGUMENT HANDLING FUNCTIONS */
-
-t_redir	*init_redir(t_shell *data);
-int		split_cmd_with_pipe(t_shell *data);
-int		count_pipe(t_shell *data);
-int		count_words(t_shell *data);
-int		is_cmd(t_token *tokens);
-int		fill_words(t_token *tokens, char **args);
-int		expand_exit_status(char **result, char *var);
-int		join_quoted_str(t_token **tokens);
-int		join_no_space(t_token **tokens);
-int		expand_token(t_shell *data);
-int		process_and_join_tokens(t_shell *data);
-void	remove_useless_token(t_token **tokens, t_token *token);
-void	detect_ambiguous_redirect(t_redir *cmd, t_token *tokens);
-void	add_redirs(t_redir **head, t_redir *redir);
-int		create_ambiguous_redirect_error(t_redir **redirs, t_token *tokens);
-int		end_with_pipe(char *input);
-int		read_complete_command(t_shell *data, char **input);
-
-		/* VARIABLE EXPANSION FUNCTIONS */
-
-char	*expand_variables(t_shell *data, char *input, t_redir *redir);
-char	*expand_and_join(t_shell *data, char *args, char *dollar);
-char	*is_exist(t_shell *data, char *args);
-char	*remove_dollar(char *args);
-char	*expand_value(char **env, char *dollar);
-char	**copy_var_name(char **tab);
-char	**copy_var_value(char **tab);
-char	*copy_name(char *str);
-char	*copy_value(char *str);
-char	*remove_and_replace(char *str, char *expanded);
-int		expand_single_variable(t_shell *data, char *input, char **str);
-int		expand_status(char *args);
-int		potential_expand(char *args, int *i);
-int		count_dollars(char *args);
-int		expand_arguments(t_shell *data, t_token *tokens, char **args);
-int		add_text(char **result, char *var);
-int		add_variable(char **result, char *value, int start, int end);
-int		check_variable(t_shell *data, char **result, char *value, int *i);
-int		multiple_expand(t_shell *data, t_token *tokens, char **args);
-int		is_env_variable(t_shell *data, char *dollar);
-int		expantion(t_shell *data, t_token *tokens);
-int		find_equal(char *str);
-void	init_parsing_indices(int *i, int *start);
-int		split_tokens(t_token *current, char *str);
-int		expand_token(t_shell *data);
-
-		/* Utills CD FUNCTIONS */
-
-void	print_cd_error(char *target);
-char	*get_home_or_oldpwd(t_shell *shell, int is_oldpwd);
-char	*get_cd_destination(t_shell *shell, char *arg);
-char	*create_full_path(char *oldpwd, char *target);
-int		check_symlink(char *path, char *oldpwd, char *target);
-
-		/* UTILITY FUNCTIONS */
-
-char	*format_shell_prompt(t_shell *shell);
-char	*get_redir_file(t_token *tokens, t_redir *redir);
-int		is_heredoc(t_redir *redir, t_shell *data);
-void	remove_useless_dollars(t_token **head);
-void	clean_empty_tokens(t_token **head);
-int		count_words_split(const char *s, char c);
-char	*ft_strstr(const char *big, const char *little);
-void	ft_display_welcome(void);
-void	*ft_memset(void *s, int c, size_t n);
-char	*ft_substr(char const *s, unsigned int start, size_t len);
-char	*ft_strjoin(const char *s1, const char *s2);
-char	*ft_strdup(const char *s);
-int		ft_strcmp(const char *s1, const char *s2);
-size_t	ft_strlen(const char *s);
-void	ft_bzero(void *s, size_t n);
-int		slen(int n);
-char	*ft_itoa(int n);
-int		ft_isalnum(int c);
-char	*ft_strchr(const char *s, int c);
-int		ft_isdigit(int c);
-char	**ft_split(const char *s, char c);
-void	ft_putendl_fd(char *s, int fd);
-void	ft_putstr_fd(const char *s, int fd);
-int		ft_putchar_fd(char c, int fd);
-int		ft_isalpha(int c);
-int		ft_strncmp(const char *s1, const char *s2, size_t n);
-int		ft_atoi(const char *nptr);
-void	ft_putnbr_fd(int n, int fd);
-void	*ft_memcpy(void *dest, const void *src, size_t n);
-int		ft_safe_size_add(size_t a, size_t b, size_t *result);
-void	*ft_calloc(size_t nmemb, size_t size);
-size_t	ft_strlcpy(char *dst, const char *src, size_t size);
-size_t	ft_strlcat(char *dst, const char *src, size_t size);
-char	*get_current_directory(t_shell *shell);
-char	*build_prompt_segment(char *user, char *dir_display);
-void	display_commands(void);
-void	display_env_commands(void);
-void	display_operators(void);
-
-#endif
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minishell.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/05/11 02:38:31 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:51:19 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MINISHELL_H
+# define MINISHELL_H
+
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
+# include <stdio.h>
+# include <stdlib.h>
+# include <unistd.h>
+# include <fcntl.h>
+# include <sys/wait.h>
+# include <signal.h>
+# include <readline/readline.h>
+# include <readline/history.h>
+# include <errno.h>
+# include <string.h>
+# include <sys/stat.h>
+# include <dirent.h>
+# include <termios.h>
+# include <limits.h>
+# include <sys/ioctl.h>
+# include <termios.h>
+# include <stdint.h>
+# include <sys/mman.h>
+# include <sys/uio.h>
+# include <sys/resource.h>
+# include <time.h>
+# include <pthread.h>
+# ifdef __SSE2__
+#  include <immintrin.h>
+# endif
+
+# define PROMPT_SIZE 256
+
+// Text colors
+# define BLACK "\033[0;30m"
+# define RED "\033[0;31m"
+# define GREEN "\033[0;32m"
+# define YELLOW "\033[0;33m"
+# define BLUE "\033[0;34m"
+# define PURPLE "\033[0;35m"
+# define CYAN "\033[0;36m"
+# define WHITE "\033[0;37m"
+
+// Bold text colors
+# define BOLD_BLACK "\033[1;30m"
+# define BOLD_RED "\033[1;31m"
+# define BOLD_GREEN "\033[1;32m"
+# define BOLD_YELLOW "\033[1;33m"
+# define BOLD_BLUE "\033[1;34m"
+# define BOLD_PURPLE "\033[1;35m"
+# define BOLD_CYAN "\033[1;36m"
+# define BOLD_WHITE "\033[1;37m"
+# define BOLD_RESET "\033[1;0m"
+# define BOLD_MAGENTA "\033[1;35m"
+# define RESET "\033[0m"
+
+# define ERROR_MALLOC "minishell: error: memory allocation failed\n"
+# define ERROR_ARGS "minishell: error: no arguments allowed\n"
+# define ERROR_QUOTES "minishell: syntax error: unclosed quote\n"
+# define ERROR_ENV_INIT "minishell: error: failed to initialize environment\n"
+# define ERROR_TOKENIZE "minishell: error: failed to create token list\n"
+# define ERROR_SYNTAX "minishell: syntax error near unexpected token"
+# define ERROR_SYNTAX_NL "minishell: syntax error near unexpected token \
+'newline'\n"
+# define ERROR_SYNTAX_PIPE "minishell: syntax error near unexpected token '|'"
+# define ERROR_HEREDOC_EOF "minishell: warning: here-document delimited \
+by end-of-file (wanted `"
+# define ERROR_UNSUPPORTED "minishell: error: unsupported character\n"
+# define ERROR_IDENTIFIER "minishell: error: not a valid identifier\n"
+# define MEM_ERROR_FATAL 1
+# define MEM_ERROR_RECOVERABLE 0
+# define BUFFER_SIZE 5
+# define TRIM_LONGEST 1
+# define TRIM_SUFFIX 2
+# define ARITH_MAX_DEPTH 1024
+# define SUBST_CHUNK 65536
+# define TIME_DEFAULT 0
+# define TIME_POSIX 1
+# define TIME_JSON 2
+# define TIME_DEFAULT_FORMAT "\nreal\t%3lR\nuser\t%3lU\nsys\t%3lS"
+# define TIME_POSIX_FORMAT "real %2R\nuser %2U\nsys %2S"
+# define HIST_FILE "/.minishell_history"
+# define HIST_MAGIC "MSHHIST1"
+# define HIST_MAGIC_LEN 8
+# define HIST_DEFAULT_SIZE 500
+# define HIST_MAX_SIZE 1000000
+# define CDPATH_CACHE_MAX 64
+# ifdef __SSE2__
+#  define FT_SIMD 1
+#  define SIMD_AVX2 __attribute__((target("avx2")))
+#  define SIMD_OVERREAD __attribute__((no_sanitize_address))
+# endif
+
+extern int	g_exit_status;
+
+typedef struct s_memory_node
+{
+	void					*ptr;
+	int						cleanup_mode;
+	void					(*free_func)(void *);
+	struct s_memory_node	*next;
+}	t_memory_node;
+
+typedef enum e_token_type
+{
+	WORD,
+	PIPE,
+	REDIR_IN,
+	REDIR_OUT,
+	APPEND,
+	HEREDOC,
+	T_EOF,
+	ERROR,
+}	t_token_type;
+
+typedef struct s_token
+{
+	t_token_type	type;
+	char			*value;
+	int				single_quote;
+	int				double_quote;
+	int				space_before;
+	int				space_after;
+	int				ar;
+	int				quoted_outside;
+	int				split_field;
+	struct s_token	*previous;
+	struct s_token	*next;
+}	t_token;
+
+typedef struct s_ifs
+{
+	unsigned char	delim[32];
+	unsigned char	space[32];
+}	t_ifs;
+
+typedef struct s_dir_cache
+{
+	char				*path;
+	char				**names;
+	unsigned char		*types;
+	int					count;
+	struct s_dir_cache	*next;
+}	t_dir_cache;
+
+typedef struct s_dir_stack
+{
+	char				*path;
+	int					fd;
+	dev_t				dev;
+	ino_t				ino;
+	struct s_dir_stack	*next;
+}	t_dir_stack;
+
+typedef struct s_cdpath_cache
+{
+	char					*prefix;
+	char					*name;
+	struct timespec			mtime;
+	long					checked;
+	int						found;
+	struct s_cdpath_cache	*next;
+}	t_cdpath_cache;
+
+typedef struct s_path_table
+{
+	char			*path;
+	char			**dirs;
+	struct timespec	*mtimes;
+	char			**names;
+	int				count;
+}	t_path_table;
+
+typedef struct s_path_index
+{
+	pthread_mutex_t	lock;
+	pthread_t		thread;
+	pid_t			owner;
+	int				building;
+	int				done;
+	t_path_table	*table;
+	t_path_table	*pending;
+}	t_path_index;
+
+typedef enum e_pat_op
+{
+	PAT_LITERAL,
+	PAT_ANY,
+	PAT_STAR,
+	PAT_CLASS,
+}	t_pat_op;
+
+typedef struct s_pat_node
+{
+	t_pat_op		op;
+	unsigned char	c;
+	unsigned char	set[32];
+}	t_pat_node;
+
+typedef struct s_pattern
+{
+	t_pat_node	*nodes;
+	int			count;
+	int			min_len;
+	int			has_star;
+	int			prefix;
+	int			suffix;
+	char		*literals;
+}	t_pattern;
+
+typedef struct s_match
+{
+	const char	*str;
+	int			len;
+	int			pi;
+	int			si;
+	int			star_pi;
+	int			star_si;
+	int			end;
+}	t_match;
+
+typedef struct s_buffer
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+}	t_buffer;
+
+typedef struct s_tri_list
+{
+	uint32_t	key;
+	t_buffer	ids;
+}	t_tri_list;
+
+typedef struct s_hist_index
+{
+	t_tri_list	*slots;
+	size_t		mask;
+	size_t		used;
+	size_t		dead;
+	int			live;
+}	t_hist_index;
+
+typedef struct s_history
+{
+	char			**lines;
+	uint32_t		*hashes;
+	uint32_t		*ids;
+	int				*table;
+	size_t			mask;
+	int				*tree;
+	uint32_t		next_id;
+	char			*path;
+	long			logged;
+	int				cap;
+	int				size;
+	int				start;
+	int				count;
+	int				live;
+	t_hist_index	index;
+}	t_history;
+
+typedef struct s_hist_rec
+{
+	uint32_t	len;
+	uint32_t	hash;
+}	t_hist_rec;
+
+typedef struct s_hist_replay
+{
+	const char	*data;
+	size_t		*offs;
+	int			*set;
+	size_t		mask;
+}	t_hist_replay;
+
+typedef struct s_isearch
+{
+	char		query[256];
+	int			len;
+	int			failed;
+	uint32_t	found;
+}	t_isearch;
+
+typedef struct s_param
+{
+	char	*name;
+	char	*value;
+	char	*word;
+	char	op;
+	char	anchor;
+	int		longest;
+}	t_param;
+
+typedef enum e_arith_op
+{
+	AR_OR,
+	AR_AND,
+	AR_BOR,
+	AR_XOR,
+	AR_BAND,
+	AR_EQ,
+	AR_NE,
+	AR_LE,
+	AR_GE,
+	AR_SHL,
+	AR_SHR,
+	AR_LT,
+	AR_GT,
+	AR_ADD,
+	AR_SUB,
+	AR_MUL,
+	AR_DIV,
+	AR_MOD,
+	AR_OP_COUNT,
+}	t_arith_op;
+
+typedef enum e_arith_error
+{
+	AR_OK,
+	AR_ERR_SYNTAX,
+	AR_ERR_DIV,
+	AR_ERR_DEPTH,
+	AR_ERR_MEMORY,
+}	t_arith_error;
+
+typedef struct s_field
+{
+	t_token	*current;
+	t_token	*last;
+	int		count;
+	int		space_after;
+}	t_field;
+
+typedef struct s_redir
+{
+	t_token_type	type;
+	char			*file_or_del;
+	char			*heredoc_content;
+	int				quoted;
+	int				quoted_outside;
+	int				ar;
+	struct s_redir	*next;
+}	t_redir;
+
+typedef struct s_char
+{
+	char	*line;
+	char	*str;
+	char	*new_line;
+}	t_char;
+
+typedef struct s_command
+{
+	char				**args;
+	char				**assigns;
+	t_redir				*redirs;
+	int					fd_in;
+	int					fd_out;
+	pid_t				pid;
+	struct s_command	*previous;
+	struct s_command	*next;
+}	t_command;
+
+typedef struct s_job
+{
+	int				id;
+	pid_t			pgid;
+	pid_t			*pids;
+	int				*status;
+	int				count;
+	int				live;
+	int				waited;
+	char			*command;
+	struct s_job	*next;
+}	t_job;
+
+typedef struct s_timing
+{
+	int				format;
+	int				count;
+	char			**names;
+	struct rusage	*stages;
+	struct timespec	start;
+	struct rusage	self;
+	struct rusage	children;
+	long			real_us;
+	struct rusage	total;
+}	t_timing;
+
+typedef enum e_trace_phase
+{
+	TRACE_IDLE,
+	TRACE_READLINE,
+	TRACE_TOKENIZE,
+	TRACE_SYNTAX,
+	TRACE_EXPAND,
+	TRACE_SPLIT,
+	TRACE_HEREDOC,
+	TRACE_RUN,
+	TRACE_FORK,
+	TRACE_WAIT,
+	TRACE_PHASES
+}	t_trace_phase;
+
+typedef struct s_trace
+{
+	int				fd;
+	long			line;
+	t_trace_phase	phase;
+	long			mark;
+	long			first_fork;
+	long			*exec_at;
+	long			spent[TRACE_PHASES];
+	char			*command;
+}	t_trace;
+
+typedef struct s_shell
+{
+	char				**env;
+	t_token				*tokens;
+	t_command			*commands;
+	t_memory_node		*memory_manager;
+	int					saved_stdin;
+	int					saved_stdout;
+	int					heredoc_interupt;
+	int					pipe_interupt;
+	int					path_was_unset;
+	int					pipe_count;
+	char				*default_path;
+	t_ifs				ifs;
+	t_dir_cache			*dir_cache;
+	t_dir_stack			*dir_stack;
+	t_cdpath_cache		*cdpath_cache;
+	long				lines_read;
+	pid_t				pid;
+	char				**env_overlay;
+	t_path_index		path_index;
+	t_history			history;
+	t_job				*jobs;
+	char				*job_command;
+	pid_t				job_pgid;
+	int					background;
+	t_timing			*timing;
+	t_trace				*trace;
+	long				pipe_size;
+}	t_shell;
+
+typedef struct s_glob
+{
+	t_shell	*shell;
+	char	**matches;
+	int		count;
+	int		capacity;
+}	t_glob;
+
+typedef struct s_arith
+{
+	t_shell			*shell;
+	const char		*p;
+	int				skip;
+	int				depth;
+	t_arith_error	error;
+}	t_arith;
+
+typedef struct s_slot
+{
+	pid_t	pid;
+	int		out_fd;
+	int		err_fd;
+}	t_slot;
+
+typedef struct s_parallel
+{
+	t_shell	*shell;
+	char	**args;
+	int		argc;
+	char	**inputs;
+	int		count;
+	int		next;
+	int		jobs;
+	int		running;
+	int		failed;
+	t_slot	*slots;
+}	t_parallel;
+
+typedef struct s_pipe_data
+{
+	pid_t	*pids;
+	int		*fork_count;
+	pid_t	*last_pid;
+	int		*input_fd;
+}	t_pipe_data;
+
+		/*SIGNAL HANDLING FUNCTIONS*/
+
+void	setup_signals(void);
+void	handle_interrupt(int sig);
+void	handle_prompt_interrupt(int sig);
+void	reset_signals_to_default(void);
+int		safely_execute_command(t_shell *shell);
+void	disable_control_char_echo(void);
+void	enable_control_char_echo(void);
+void	handle_heredoc_interrupt(int sig);
+void	setup_heredoc_signal_handlers(struct sigaction *old_int, \
+	struct sigaction *old_quit);
+void	restore_signal_handlers(struct sigaction *old_int, \
+	struct sigaction *old_quit);
+void	restore_signals_clear_buffer(struct sigaction *old_int, \
+	struct sigaction *old_quit);
+void	display_heredoc_eof_warning(char *delim);
+void	restore_standard_fds(t_shell *shell);
+
+		/* BUILTIN FUNCTIONS */
+
+int		builtin_cd(t_shell *shell, t_command *cmd);
+int		builtin_echo(t_command *cmd);
+int		builtin_env(t_shell *shell, t_command *cmd);
+int		builtin_exit(t_shell *shell, t_command *cmd);
+int		builtin_export(t_shell *shell, t_command *cmd);
+int		builtin_pwd(t_shell *shell, t_command *cmd);
+int		builtin_unset(t_shell *shell, t_command *cmd);
+int		builtin_help(t_shell *shell);
+int		builtin_jobs(t_shell *shell, t_command *cmd);
+int		builtin_wait(t_shell *shell, t_command *cmd);
+int		builtin_parallel(t_shell *shell, t_command *cmd);
+int		builtin_set(t_shell *shell, t_command *cmd);
+int		builtin_pushd(t_shell *shell, t_command *cmd);
+int		builtin_popd(t_shell *shell, t_command *cmd);
+int		builtin_dirs(t_shell *shell, t_command *cmd);
+int		is_builtin(t_command *cmd);
+int		run_builtin(t_shell *shell, t_command *cmd);
+void	run_builtin_command(t_shell *shell, t_command *cmd);
+void	execute_external_command(t_shell *shell, t_command *cmd);
+
+		/* EXECUTION FUNCTIONS */
+
+void	execute_non_piped_command(t_shell *shell, t_command *cmd);
+void	execute_command_sequence(t_shell *shell);
+void	ignore_sigint_and_wait(pid_t child_pid);
+void	setup_and_execute_child_process(t_shell *shell, t_command *cmd);
+void	execute_pipe(t_shell *shell, t_command *cmd, pid_t *pids);
+int		create_pipe_if_needed(t_shell *shell, t_command *cmd,
+			int pipe_fds[2]);
+int		fork_pipe_child(t_shell *shell, t_command *cmd, \
+int input_fd, int pipe_fds[2]);
+char	*search_path_for_exec(char *cmd, t_shell *shell);
+char	*get_command_path(t_shell *shell, t_command *cmd);
+
+		/* ENVIRONMENT FUNCTIONS */
+
+char	**get_env(char **envp, t_shell *shell);
+char	*get_env_value(t_shell *shell, const char *var_name);
+int		is_assignment_word(const char *word);
+char	*overlay_value(char **overlay, const char *name, size_t len);
+char	**exec_environment(t_shell *shell);
+char	**add_env_var(t_shell *shell, char *new_var);
+char	**init_env(char **envp, t_shell *shell);
+char	**init_minimal_env(void);
+int		env_error(const char *msg, t_memory_node **gc);
+int		duplicate_existing_vars(t_shell *shell, char **new_env, int size);
+int		add_to_env(t_shell *shell, char *new_var);
+int		find_var_pos(char *var_name, t_shell *shell);
+int		is_valid_identifier(const char *str);
+int		env_has_path(char **envp);
+void	update_env(t_shell *shell, char *var, char *new_value);
+
+		/*HEREDOC REDIRECT FUNCTIONS*/
+
+char	*capture_heredoc(t_redir *redirs, t_shell *data);
+int		setup_heredoc_pipe(t_command *cmd, t_redir *redir);
+char	*get_next_line(int fd, int clear);
+char	*read_and_store(char *buffer, int fd);
+char	*update_buffer(char *buffer);
+char	*extract_line(char *buffer);
+
+		/* PIPE EXECUTION FUNCTIONS */
+
+void	setup_pipeline_execution(t_shell *shell, t_command *cmd);
+char	*combine_command_arguments(t_shell *shell, char **args);
+int		process_single_piped_command(t_shell *shell, t_command *cmd,
+			t_pipe_data *data);
+void	collect_pipeline_exit_status(pid_t *pids, int count, pid_t last_pid,
+			struct rusage *usage);
+void	exit_forked_child(int exit_code);
+void	handle_pipe_child(t_shell *shell, t_command *cmd, int input_fd,
+			int pipe_fds[2]);
+
+		/* REDIRECTION FUNCTIONS */
+
+int		process_command_redirections(t_command *cmd, t_shell *shell);
+void	update_command_redirections(t_command *cmd, int type, int fd);
+int		report_file_error(const char *filename);
+int		open_file_for_input(const char *path);
+int		open_file_for_output(const char *path);
+int		open_file_for_append(const char *path);
+int		open_redir_file(t_redir *redir, t_command *cmd);
+void	setup_command_io(t_command *cmd, int input_fd, int pipe_fds[2]);
+void	setup_command_output(t_command *cmd, int pipe_fds[2]);
+void	setup_command_input(t_command *cmd, int input_fd);
+void	apply_command_redirections(t_command *cmd);
+
+	/* SHELL INITIALIZATION AND MANAGEMENT */
+
+void	init_shell_fds(t_shell *shell);
+int		is_shell_command(char *cmd);
+int		is_fd_writable(int fd, const char *cmd_name);
+void	clean_and_exit_shell(t_shell *shell, int exit_code);
+void	update_shell_lvl(t_shell *shell);
+void	cleanup_shell_file_descriptors(t_shell *shell);
+void	error(const char *cmd, const char *error_item, const char *msg);
+void	error_quoted(const char *cmd, const char *error_item, const char *msg);
+void	display_error_and_exit(t_shell *shell, const char *cmd, const char *msg,
+			int exit_code);
+
+	/* MEMORY MANAGEMENT FUNCTIONS */
+
+char	*managed_string_copy(t_memory_node \
+	**memory_manager, const char *s1);
+char	*join_managed_strings(t_memory_node **memory_manager, const char *s1, \
+	const char *s2);
+char	*gc_itoa(t_memory_node **memory_manager, int n);
+int		track_memory_allocation(t_memory_node **memory_manager, \
+	void *ptr, int cleanup_mode, \
+	void (*free_func)(void *));
+void	release_all_memory(t_memory_node **memory_manager);
+void	*allocate_managed_memory(t_memory_node **memory_manager, \
+	size_t size, int cleanup_mode, void (*free_func)(void *));
+void	free_array(void *ptr);
+void	free_redirs(t_redir **redirs);
+void	free_command(t_command **cmd);
+void	free_tokens_list(t_token **head);
+
+		/* TOKENIZATION AND SYNTAX CHECKING FUNCTIONS */
+
+t_token	*tokenize_input(char *input);
+t_token	*create_token(t_token_type type, char *value);
+int		handle_in_quote(int start_quote, char *input, int *i, t_token **tokens);
+int		handle_double_operator(int *i, t_token **tokens,
+			t_token_type operator);
+int		handle_single_operator(int *i, t_token **tokens,
+			t_token_type operator);
+int		is_operator(char *str, int i);
+int		is_whitespace(char c);
+int		is_quote(char c);
+void	add_token(t_token **head, t_token *new_token);
+int		is_whitespace_bis(char *str);
+void	restore_signals_clear_buffer(struct sigaction *old_int,
+			struct sigaction *old_quit);
+int		syntax_check(t_shell *cmd);
+int		add_token_error(t_token **tokens, t_token *token, char *str);
+int		is_token_operator(t_token_type token_type);
+int		is_operator_follow(t_token **tokens, t_token *current_token);
+int		check_unsupported_character(t_token **tokens);
+int		check_token_error(t_token **tokens);
+int		check_unsupported_character(t_token **tokens);
+
+		/* COMMAND AND ARGUMENT HANDLING FUNCTIONS */
+
+t_redir	*init_redir(t_shell *data);
+int		split_cmd_with_pipe(t_shell *data);
+int		count_pipe(t_shell *data);
+int		count_words(t_shell *data, size_t *bytes);
+int		expand_exit_status(char **result, char *var);
+int		join_quoted_str(t_token **tokens);
+int		join_no_space(t_token **tokens);
+int		expand_token(t_shell *data);
+int		process_and_join_tokens(t_shell *data);
+void	remove_useless_token(t_token **tokens, t_token *token);
+void	detect_ambiguous_redirect(t_redir *cmd, t_token *tokens);
+void	add_redirs(t_redir **head, t_redir *redir);
+int		create_ambiguous_redirect_error(t_redir **redirs, t_token *tokens);
+int		end_with_pipe(char *input);
+int		read_complete_command(t_shell *data, char **input);
+
+		/* VARIABLE EXPANSION FUNCTIONS */
+
+char	*expand_variables(t_shell *data, char *input, t_redir *redir);
+char	*expand_and_join(t_shell *data, char *args, char *dollar);
+char	*is_exist(t_shell *data, char *args);
+char	*remove_dollar(char *args);
+char	*expand_value(char **env, char *dollar);
+char	**copy_var_name(char **tab);
+char	**copy_var_value(char **tab);
+char	*copy_name(char *str);
+char	*copy_value(char *str);
+char	*remove_and_replace(char *str, char *expanded);
+int		expand_single_variable(t_shell *data, char *input, char **str);
+int		expand_status(char *args);
+int		potential_expand(char *args, int *i);
+int		count_dollars(char *args);
+int		expand_arguments(t_shell *data, t_token *tokens, char **args);
+int		add_text(char **result, char *var);
+int		add_variable(char **result, char *value, int start, int end);
+int		check_variable(t_shell *data, char **result, char *value, int *i);
+int		multiple_expand(t_shell *data, t_token *tokens, char **args);
+int		is_env_variable(t_shell *data, char *dollar);
+int		expantion(t_shell *data, t_token *tokens);
+int		find_equal(char *str);
+void	init_parsing_indices(int *i, int *start);
+int		split_tokens(t_shell *data, t_token *current, char *str);
+void	link_token_to_list(t_token *current, t_token *new_token);
+int		expand_token(t_shell *data);
+void	load_ifs(t_shell *data);
+int		ifs_bit(const unsigned char *map, char c);
+int		skip_ifs_space(t_ifs *ifs, char *str, int i);
+int		skip_ifs_delimiters(t_ifs *ifs, char *str, int i);
+int		ifs_field_end(t_ifs *ifs, char *str, int i);
+
+		/* PATHNAME EXPANSION FUNCTIONS */
+
+int		expand_globs(t_shell *data);
+int		has_glob_chars(const char *str);
+int		glob_segments(t_glob *glob, char *base, char *pattern);
+int		add_glob_match(t_glob *glob, char *path);
+t_dir_cache	*get_dir_listing(t_shell *shell, char *path);
+void	free_dir_cache(t_shell *shell);
+void	sort_strings(char **items, int count);
+
+		/* COMMAND COMPLETION FUNCTIONS */
+
+void	*build_path_index(void *arg);
+void	free_path_table(t_path_table *t);
+void	path_index_start(t_shell *shell);
+void	path_index_refresh(t_shell *shell);
+void	free_path_index(t_shell *shell);
+void	install_command_completion(t_shell *shell);
+
+		/* HISTORY FUNCTIONS */
+
+int		history_append(t_history *h, const char *line, size_t len,
+			uint32_t hash);
+int		history_push(t_history *h, const char *line, uint32_t hash);
+void	history_table_add(t_history *h, int slot);
+void	history_table_drop(t_history *h, int slot);
+void	history_squeeze(t_history *h);
+void	history_tree_mark(t_history *h, int slot, int delta);
+void	history_tree_build(t_history *h);
+int		history_rank(t_history *h, int slot);
+void	free_history(t_history *h);
+uint32_t	history_hash(const char *line, size_t len);
+int		history_open_log(t_history *h);
+void	history_log_append(t_history *h, const char *line, uint32_t hash);
+void	history_compact(t_history *h);
+int		history_replay(t_history *h, const char *data, size_t size,
+			size_t *end);
+void	history_load(t_shell *shell);
+void	history_trim_log(t_history *h);
+void	hist_index_rebuild(t_history *h);
+t_tri_list	*hist_index_slot(t_hist_index *x, const char *p, int claim);
+int		hist_index_add(t_hist_index *x, const char *line, uint32_t id);
+void	hist_index_free(t_hist_index *x);
+char	*history_entry(t_history *h, uint32_t id);
+uint32_t	history_lookup(t_history *h, const char *query, uint32_t before);
+void	install_history_search(t_history *h);
+void	init_history(t_shell *shell);
+void	record_history(t_shell *shell, char *line);
+
+		/* PATTERN MATCHING FUNCTIONS */
+
+int		pattern_compile(t_pattern *pat, const char *src);
+int		pattern_match(t_pattern *pat, const char *str, int len);
+int		pattern_node_match(t_pat_node *node, char c);
+int		match_middle(t_pattern *pat, const char *str, int len);
+void	pattern_free(t_pattern *pat);
+
+		/* PARAMETER EXPANSION FUNCTIONS */
+
+int		skip_word_char(const char *str, int i);
+int		expand_braced(t_shell *data, char **result, char *value, int *i);
+int		parse_param(char *body, t_param *param);
+int		lookup_param(t_shell *data, t_param *param);
+void	free_param(t_param *param);
+int		apply_param(t_shell *data, t_param *param, char **out);
+int		trim_param(t_param *param, char *pattern, char *rep, char **out);
+int		replace_param(t_param *param, char *pattern, char *rep, char **out);
+int		substring_param(t_param *param, char **out);
+int		expand_word(t_shell *data, char *word, char **out);
+int		buffer_reserve(t_buffer *buf, size_t extra);
+int		buffer_append(t_buffer *buf, const char *src, size_t len);
+char	*buffer_finish(t_buffer *buf);
+int		buffer_append_num(t_buffer *buf, long n, int width);
+
+		/* ARITHMETIC EXPANSION FUNCTIONS */
+
+int		expand_arith(t_shell *data, char **result, char *value, int *i);
+char	*arith_format(int64_t n, char *digits);
+int64_t	arith_run(t_arith *ctx);
+int64_t	arith_comma(t_arith *ctx);
+int64_t	arith_assign(t_arith *ctx);
+int64_t	arith_binary(t_arith *ctx, int min_prec);
+int64_t	arith_apply(t_arith *ctx, int op, int64_t a, int64_t b);
+int64_t	arith_unary(t_arith *ctx);
+int64_t	arith_read_var(t_arith *ctx, const char *name, int len);
+void	arith_store(t_arith *ctx, const char *name, int len, int64_t value);
+int64_t	arith_number(t_arith *ctx);
+int64_t	arith_fail(t_arith *ctx, t_arith_error error);
+void	arith_skip_spaces(t_arith *ctx);
+int		arith_name_len(const char *p);
+int		arith_peek_op(t_arith *ctx);
+int		arith_prec(int op);
+const char	*arith_op_str(int op);
+
+		/* JOB CONTROL FUNCTIONS */
+
+int		take_background(t_shell *shell, char *input);
+void	end_background(t_shell *shell);
+void	enter_background(t_shell *shell, int input_fd);
+int		add_job(t_shell *shell, pid_t *pids, int count);
+int		job_update(t_job *job, pid_t pid, int status);
+int		job_exit_code(t_job *job);
+void	poll_jobs(t_shell *shell);
+void	notify_jobs(t_shell *shell);
+void	print_job(t_job *job, const char *state, const char *suffix);
+void	free_jobs(t_shell *shell);
+
+		/* TIME KEYWORD FUNCTIONS */
+
+int		take_time(t_shell *shell, char *input);
+void	run_timed(t_shell *shell);
+void	free_timing(t_shell *shell);
+struct rusage	*stage_usage(t_shell *shell);
+long	tv_us(struct timeval tv);
+void	report_timing(t_shell *shell, t_timing *t);
+void	report_json(t_timing *t);
+int		append_seconds(t_buffer *buf, long us, int precision, int long_form);
+
+		/* PHASE TRACING FUNCTIONS */
+
+void	init_trace(t_shell *shell);
+t_trace_phase	trace_phase(t_shell *shell, t_trace_phase phase);
+void	trace_exec(t_shell *shell);
+void	trace_command(t_shell *shell, const char *input);
+void	trace_flush(t_shell *shell);
+void	free_trace(t_shell *shell);
+int		append_json_string(t_buffer *buf, const char *s);
+
+		/* PARALLEL RUNNER FUNCTIONS */
+
+void	run_parallel(t_parallel *p);
+
+		/* COMMAND SUBSTITUTION FUNCTIONS */
+
+int		expand_cmdsub(t_shell *data, char **result, char *value, int *i);
+int		run_subst(t_shell *shell, char *text, t_buffer *out);
+int		subst_inline(t_shell *shell, t_command *cmd, t_buffer *out);
+int		subst_fork(t_shell *shell, char *text, t_buffer *out);
+int		read_subst_output(int fd, t_buffer *out);
+int		is_inline_builtin(t_command *cmd);
+
+		/* Utills CD FUNCTIONS */
+
+void	print_cd_error(char *target);
+int		handle_double_slash(t_shell *shell, char *oldpwd, char *target);
+char	*get_home_or_oldpwd(t_shell *shell, int is_oldpwd);
+char	*get_cd_destination(t_shell *shell, char *arg);
+char	*create_full_path(char *oldpwd, char *target);
+int		canon_logical_path(char *dst, const char *base, const char *path);
+t_dir_stack	*dir_entry_here(t_shell *shell);
+int		dir_entry_enter(t_shell *shell, t_dir_stack *entry, char *name);
+void	free_dir_entry(t_dir_stack *entry);
+void	free_dir_stack(t_shell *shell);
+char	*cdpath_search(t_shell *shell, char *arg, char **cdpath);
+t_cdpath_cache	*cdpath_verdict(t_shell *shell, char *dir, char *name);
+void	free_cdpath_cache(t_shell *shell);
+
+		/* UTILITY FUNCTIONS */
+
+char	*format_shell_prompt(t_shell *shell);
+char	*get_redir_file(t_token *tokens, t_redir *redir);
+int		is_heredoc(t_redir *redir, t_shell *data);
+void	remove_useless_dollars(t_token **head);
+void	clean_empty_tokens(t_token **head);
+int		count_words_split(const char *s, char c);
+char	*ft_strstr(const char *big, const char *little);
+void	ft_display_welcome(void);
+void	*ft_memset(void *s, int c, size_t n);
+char	*ft_substr(char const *s, unsigned int start, size_t len);
+char	*ft_strjoin(const char *s1, const char *s2);
+char	*ft_strdup(const char *s);
+int		ft_strcmp(const char *s1, const char *s2);
+size_t	ft_strlen(const char *s);
+void	ft_bzero(void *s, size_t n);
+int		slen(int n);
+char	*ft_itoa(int n);
+int		ft_isalnum(int c);
+char	*ft_strchr(const char *s, int c);
+int		ft_isdigit(int c);
+char	**ft_split(const char *s, char c);
+void	ft_putendl_fd(char *s, int fd);
+void	ft_putstr_fd(const char *s, int fd);
+int		ft_putchar_fd(char c, int fd);
+int		ft_isalpha(int c);
+int		ft_strncmp(const char *s1, const char *s2, size_t n);
+int		ft_atoi(const char *nptr);
+void	ft_putnbr_fd(int n, int fd);
+void	*ft_memcpy(void *dest, const void *src, size_t n);
+void	*ft_memchr(const void *s, int c, size_t n);
+int		ft_memcmp(const void *s1, const void *s2, size_t n);
+int		ft_safe_size_add(size_t a, size_t b, size_t *result);
+void	*ft_calloc(size_t nmemb, size_t size);
+size_t	ft_strlcpy(char *dst, const char *src, size_t size);
+size_t	ft_strlcat(char *dst, const char *src, size_t size);
+char	*get_current_directory(t_shell *shell);
+void	put_home_path(t_shell *shell, char *path, int fd);
+char	*build_prompt_segment(char *user, char *dir_display);
+void	display_commands(void);
+void	display_env_commands(void);
+void	display_operators(void);
+
+#endif
@@ -6,129 +6,149 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 18:46:32 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 18:46:32 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:57:28 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
 /**
- * Creates logical path for symlinks
+ * Updates PWD and OLDPWD once the directory has been entered
+ * PWD becomes the logical path when there is one, and getcwd otherwise.
+ * PWD is only kept up to date when it is set.
  */
-static	char	*create_symlink_path(char *oldpwd, char *target)
-{
-	char	*logical_path;
-	char	*temp;
-
-	if (target[0] == '/')
-		logical_path = ft_strdup(target);
-	else if (oldpwd)
-	{
-		if (oldpwd[ft_strlen(oldpwd) - 1] == '/')
-			logical_path = ft_strjoin(oldpwd, target);
-		else
-		{
-			temp = ft_strjoin(oldpwd, "/");
-			logical_path = ft_strjoin(temp, target);
-			free(temp);
-		}
-	}
-	else
-		logical_path = getcwd(NULL, 0);
-	return (logical_path);
-}
-
-/** * Updates PWD and OLDPWD environment variables with logical path
- * If the target is a symlink, it creates a logical path based on the old PWD.
- * If not, it uses getcwd to get the current working directory.
- */
-static	int	update_pwd_vars_with_logical_path(t_shell *shell, char *target)
+static	int	update_pwd_vars(t_shell *shell, char *logical)
 {
 	char	*oldpwd;
-	char	*logical_path;
-	int		is_symlink;
-	int		pwd_was_set;
+	char	*cwd;
 
-	pwd_was_set = (get_env_value(shell, "PWD") != NULL);
 	oldpwd = get_env_value(shell, "PWD");
-	is_symlink = check_symlink(target, oldpwd, target);
-	if (is_symlink)
-		logical_path = create_symlink_path(oldpwd, target);
-	else
-		logical_path = getcwd(NULL, 0);
-	if (!logical_path)
+	cwd = NULL;
+	if (!logical[0])
 	{
-		error("getcwd", NULL, strerror(errno));
-		g_exit_status = 1;
-		return (1);
+		cwd = getcwd(NULL, 0);
+		if (!cwd)
+		{
+			error("getcwd", NULL, strerror(errno));
+			g_exit_status = 1;
+			return (1);
+		}
+		logical = cwd;
 	}
 	if (oldpwd)
 		update_env(shell, "OLDPWD", oldpwd);
-	if (pwd_was_set)
-		update_env(shell, "PWD", logical_path);
-	free(logical_path);
+	if (oldpwd)
+		update_env(shell, "PWD", logical);
+	free(cwd);
 	return (0);
 }
 
 /**
  * Validates cd command arguments
+ * Leading -L and -P options select logical (the default) or physical
+ * handling of "..", the last one given wins.
+ * Returns the index of the directory operand, or -1 on error.
  */
-static int	validate_cd_args(t_shell *shell, t_command *cmd, int *count_args)
+static int	parse_cd_args(t_command *cmd, int *physical)
 {
-	*count_args = 0;
-	if (!shell || !cmd || !cmd->args)
+	int	i;
+
+	*physical = 0;
+	if (!cmd || !cmd->args)
 	{
 		error("cd", NULL, "internal error");
 		g_exit_status = 1;
-		return (1);
+		return (-1);
+	}
+	i = 1;
+	while (cmd->args[i] && (ft_strcmp(cmd->args[i], "-L") == 0
+			|| ft_strcmp(cmd->args[i], "-P") == 0))
+	{
+		*physical = (cmd->args[i][1] == 'P');
+		i++;
 	}
-	while (cmd->args[*count_args])
-		(*count_args)++;
-	if (*count_args > 2)
+	if (cmd->args[i] && cmd->args[i + 1])
 	{
 		error("cd", NULL, "too many arguments");
 		g_exit_status = 1;
-		return (1);
+		return (-1);
 	}
-	return (0);
+	return (i);
+}
+
+/**
+ * Enters the target directory
+ * Logically, the canonical path built from PWD is entered and kept in
+ * @logical. The target itself is entered, and @logical left empty for
+ * getcwd to name it, with -P or when the logical path cannot be built
+ * or entered. Errors are left to the caller to report.
+ */
+static int	enter_directory(t_shell *shell, char *target, int physical,
+	char *logical)
+{
+	if (!physical && canon_logical_path(logical,
+			get_env_value(shell, "PWD"), target) == 0
+		&& chdir(logical) == 0)
+		return (0);
+	logical[0] = '\0';
+	if (chdir(target) == 0)
+		return (0);
+	return (-1);
 }
 
 /**
- * Handles special case for // paths
+ * Enters the first directory found for the argument along CDPATH
+ * A directory that cannot be entered drops the cached verdicts, which
+ * may be stale, and the search goes on with the next prefixes.
+ * Returns the directory entered, or NULL when cd should use its
+ * argument as is.
  */
-static int	handle_double_slash(t_shell *shell, char *oldpwd, char *target)
+static char	*enter_cdpath(t_shell *shell, char *arg, int physical,
+	char *logical)
 {
-	if (target && ft_strcmp(target, "//") == 0)
+	char	*cdpath;
+	char	*found;
+
+	cdpath = get_env_value(shell, "CDPATH");
+	found = cdpath_search(shell, arg, &cdpath);
+	while (found && enter_directory(shell, found, physical, logical) == -1)
 	{
-		if (oldpwd)
-			update_env(shell, "OLDPWD", oldpwd);
-		update_env(shell, "PWD", "//");
-		return (1);
+		free_cdpath_cache(shell);
+		free(found);
+		found = cdpath_search(shell, arg, &cdpath);
 	}
-	return (0);
+	return (found);
 }
 
 /**
  * Built-in command to change the current directory
+ * A relative argument is first searched for along CDPATH; when found
+ * there, the new directory is printed as bash does.
  */
 int	builtin_cd(t_shell *shell, t_command *cmd)
 {
+	char	logical[PATH_MAX];
 	char	*target;
-	int		count_args;
-	char	*oldpwd;
+	char	*found;
+	int		i;
+	int		physical;
 
-	if (validate_cd_args(shell, cmd, &count_args))
+	i = parse_cd_args(cmd, &physical);
+	if (i < 0)
 		return (1);
-	target = get_cd_destination(shell, cmd->args[1]);
+	found = enter_cdpath(shell, cmd->args[i], physical, logical);
+	target = found;
+	if (!found)
+		target = get_cd_destination(shell, cmd->args[i]);
 	if (!target)
 		return (1);
-	oldpwd = get_env_value(shell, "PWD");
-	if (chdir(target) == -1)
-	{
-		print_cd_error(target);
-		return (1);
-	}
-	if (handle_double_slash(shell, oldpwd, target))
-		return (0);
-	return (update_pwd_vars_with_logical_path(shell, target));
+	if (!found && enter_directory(shell, target, physical, logical) == -1)
+		return (print_cd_error(target), 1);
+	if (handle_double_slash(shell, get_env_value(shell, "PWD"), target))
+		return (free(found), 0);
+	i = update_pwd_vars(shell, logical);
+	if (found && i == 0)
+		ft_putendl_fd(get_env_value(shell, "PWD"), STDOUT_FILENO);
+	free(found);
+	return (i);
 }
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dirs.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:47:31 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:59:36 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * print_dir_stack - Prints the current directory and the stack
+ * @shell: Shell context
+ * @long_form: Non-zero to print paths under HOME in full
+ */
+
+static void	print_dir_stack(t_shell *shell, int long_form)
+{
+	t_dir_stack	cur;
+	t_dir_stack	*entry;
+
+	cur.path = get_current_directory(shell);
+	cur.next = shell->dir_stack;
+	entry = &cur;
+	while (entry && entry->path)
+	{
+		if (long_form)
+			ft_putstr_fd(entry->path, STDOUT_FILENO);
+		else
+			put_home_path(shell, entry->path, STDOUT_FILENO);
+		entry = entry->next;
+		if (entry)
+			ft_putstr_fd(" ", STDOUT_FILENO);
+	}
+	ft_putstr_fd("\n", STDOUT_FILENO);
+	free(cur.path);
+}
+
+/**
+ * change_dir - Changes directory the way cd does
+ * @shell: Shell context
+ * @dir: The directory argument
+ *
+ * Returns the status of cd.
+ */
+
+static int	change_dir(t_shell *shell, char *dir)
+{
+	t_command	cd;
+	char		*args[3];
+
+	ft_memset(&cd, 0, sizeof(t_command));
+	args[0] = "cd";
+	args[1] = dir;
+	args[2] = NULL;
+	cd.args = args;
+	cd.fd_in = STDIN_FILENO;
+	cd.fd_out = STDOUT_FILENO;
+	return (builtin_cd(shell, &cd));
+}
+
+/**
+ * builtin_dirs - Shows or clears the directory stack
+ * @shell: Shell context holding the stack
+ * @cmd: "dirs [-c | -l]"
+ *
+ * Returns 0 on success, 1 on a usage error.
+ */
+
+int	builtin_dirs(t_shell *shell, t_command *cmd)
+{
+	if (!cmd->args[1])
+		return (print_dir_stack(shell, 0), 0);
+	if (!cmd->args[2] && ft_strcmp(cmd->args[1], "-l") == 0)
+		return (print_dir_stack(shell, 1), 0);
+	if (!cmd->args[2] && ft_strcmp(cmd->args[1], "-c") == 0)
+	{
+		free_dir_stack(shell);
+		return (0);
+	}
+	error("dirs", NULL, "usage: dirs [-c | -l]");
+	return (1);
+}
+
+/**
+ * builtin_pushd - Pushes the current directory and changes to another
+ * @shell: Shell context holding the stack
+ * @cmd: "pushd [dir]"
+ *
+ * With a directory, it is entered the way cd does and the previous one
+ * is pushed. Without, the current directory and the top of the stack
+ * trade places; returning to a stacked directory uses the descriptor
+ * kept for it and resolves nothing.
+ * Returns 0 on success, 1 on failure.
+ */
+
+int	builtin_pushd(t_shell *shell, t_command *cmd)
+{
+	t_dir_stack	*here;
+
+	if (cmd->args[1] && cmd->args[2])
+		return (error("pushd", NULL, "too many arguments"), 1);
+	if (!cmd->args[1] && !shell->dir_stack)
+		return (error("pushd", NULL, "no other directory"), 1);
+	here = dir_entry_here(shell);
+	if (!here)
+		return (1);
+	if ((!cmd->args[1] && dir_entry_enter(shell, shell->dir_stack, "pushd"))
+		|| (cmd->args[1] && change_dir(shell, cmd->args[1])))
+		return (free_dir_entry(here), 1);
+	here->next = shell->dir_stack;
+	if (!cmd->args[1])
+	{
+		here->next = shell->dir_stack->next;
+		free_dir_entry(shell->dir_stack);
+	}
+	shell->dir_stack = here;
+	return (print_dir_stack(shell, 0), 0);
+}
+
+/**
+ * builtin_popd - Returns to the directory on top of the stack
+ * @shell: Shell context holding the stack
+ * @cmd: "popd"
+ *
+ * The entry is only removed once its directory has been entered.
+ * Returns 0 on success, 1 on failure.
+ */
+
+int	builtin_popd(t_shell *shell, t_command *cmd)
+{
+	t_dir_stack	*top;
+
+	if (cmd->args[1])
+		return (error("popd", NULL, "usage: popd"), 1);
+	if (!shell->dir_stack)
+		return (error("popd", NULL, "directory stack empty"), 1);
+	top = shell->dir_stack;
+	if (dir_entry_enter(shell, top, "popd"))
+		return (1);
+	shell->dir_stack = top->next;
+	free_dir_entry(top);
+	return (print_dir_stack(shell, 0), 0);
+}
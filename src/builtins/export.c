@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/11 02:38:51 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/24 01:05:40 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:03:03 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -70,59 +70,64 @@ static	int	export_with_value(char *arg, t_shell *shell)
 	return (free(var_name), 0);
 }
 
-static void	print_single_export_line(const char *var)
+/**
+ * append_export_line - Appends the export line of one variable
+ * @buf: The listing, with room reserved for the line
+ * @var: The variable, NAME=value or a bare NAME
+ */
+
+static void	append_export_line(t_buffer *buf, const char *var)
 {
 	const char	*equal_sign = ft_strchr(var, '=');
 
 	if (var[0] == '_' && (var[1] == '=' || var[1] == '\0'))
 		return ;
-	ft_putstr_fd("export ", STDOUT_FILENO);
-	if (equal_sign && *(equal_sign + 1) != '\0')
-	{
-		write(STDOUT_FILENO, var, equal_sign - var);
-		ft_putstr_fd("=\"", STDOUT_FILENO);
-		ft_putstr_fd(equal_sign + 1, STDOUT_FILENO);
-		ft_putstr_fd("\"\n", STDOUT_FILENO);
-	}
-	else if (equal_sign && *(equal_sign + 1) == '\0')
-	{
-		write(STDOUT_FILENO, var, equal_sign - var);
-		ft_putstr_fd("=\"\"\n", STDOUT_FILENO);
-	}
-	else
+	buffer_append(buf, "export ", 7);
+	if (!equal_sign)
 	{
-		ft_putstr_fd(var, STDOUT_FILENO);
-		ft_putchar_fd('\n', STDOUT_FILENO);
+		buffer_append(buf, var, ft_strlen(var));
+		buffer_append(buf, "\n", 1);
+		return ;
 	}
+	buffer_append(buf, var, equal_sign - var + 1);
+	buffer_append(buf, "\"", 1);
+	buffer_append(buf, equal_sign + 1, ft_strlen(equal_sign + 1));
+	buffer_append(buf, "\"\n", 2);
 }
 
+/**
+ * print_export - Lists the environment in export format
+ * @shell: Shell context
+ *
+ * The variables are sorted through a table of pointers to them with the
+ * merge sort, and the whole listing goes out in a single write, sized
+ * up front so it is built without growing.
+ */
+
 static	void	print_export(t_shell *shell)
 {
-	char	**env_copy;
-	int		var_count;
-	int		i;
+	char		**sorted;
+	t_buffer	buf;
+	size_t		bytes;
+	int			count;
+	int			i;
 
+	count = 0;
+	bytes = 0;
+	while (shell->env[count])
+		bytes += ft_strlen(shell->env[count++]) + 12;
+	sorted = malloc(sizeof(char *) * (count + 1));
+	ft_memset(&buf, 0, sizeof(t_buffer));
+	if (!sorted || buffer_reserve(&buf, bytes))
+		return (free(sorted), error(NULL, NULL, ERROR_MALLOC));
+	ft_memcpy(sorted, shell->env, sizeof(char *) * count);
+	sort_strings(sorted, count);
 	i = 0;
-	var_count = 0;
-	while (shell->env[var_count])
-		var_count++;
-	env_copy = allocate_managed_memory(&shell->memory_manager, \
-		sizeof(char *) * (var_count + 1), MEM_ERROR_RECOVERABLE, NULL);
-	if (!env_copy)
-		return (error(NULL, NULL, ERROR_MALLOC));
-	while (i < var_count)
-	{
-		env_copy[i] = managed_string_copy \
-		(&shell->memory_manager, shell->env[i]);
-		if (!env_copy[i])
-			return (error(NULL, NULL, ERROR_MALLOC));
-		i++;
-	}
-	env_copy[i] = NULL;
-	sort_env_for_export(env_copy);
-	i = 0;
-	while (env_copy[i])
-		print_single_export_line(env_copy[i++]);
+	while (i < count)
+		append_export_line(&buf, sorted[i++]);
+	write(STDOUT_FILENO, buf.data, buf.len);
+	free(sorted);
+	free(buf.data);
 }
 
 int	builtin_export(t_shell *shell, t_command *cmd)
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jobs.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:50:49 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:59:36 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * print_job - Prints one line of the job table
+ * @job: The job
+ * @state: Text describing the state of the job
+ * @suffix: Text printed after the command
+ *
+ * The line is built in a buffer and written at once, so that it goes
+ * through the descriptor the builtin is redirected to.
+ */
+
+void	print_job(t_job *job, const char *state, const char *suffix)
+{
+	t_buffer	buf;
+	size_t		len;
+	int			ok;
+
+	ft_memset(&buf, 0, sizeof(buf));
+	len = ft_strlen(state);
+	ok = (!buffer_append(&buf, "[", 1) && !buffer_append_num(&buf, job->id, 1)
+			&& !buffer_append(&buf, "]  ", 3)
+			&& !buffer_append(&buf, state, len));
+	while (ok && len++ < 24)
+		ok = !buffer_append(&buf, " ", 1);
+	ok = (ok && !buffer_append(&buf, job->command, ft_strlen(job->command))
+			&& !buffer_append(&buf, suffix, ft_strlen(suffix))
+			&& !buffer_append(&buf, "\n", 1));
+	if (ok)
+		write(STDOUT_FILENO, buf.data, buf.len);
+	free(buf.data);
+}
+
+/**
+ * builtin_jobs - Lists the background jobs
+ * @shell: Shell context holding the job table
+ * @cmd: The command and its arguments
+ *
+ * Running jobs are listed first, then finished jobs are reported and
+ * removed from the table.
+ * Returns 0 on success, 1 on error.
+ */
+
+int	builtin_jobs(t_shell *shell, t_command *cmd)
+{
+	t_job	*job;
+
+	if (cmd->args[1])
+	{
+		error("jobs", NULL, "options not supported");
+		return (1);
+	}
+	poll_jobs(shell);
+	job = shell->jobs;
+	while (job)
+	{
+		if (job->live)
+			print_job(job, "Running", " &");
+		job = job->next;
+	}
+	notify_jobs(shell);
+	return (0);
+}
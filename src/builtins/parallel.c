@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:53:08 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:52:34 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * parse_jobs - Reads the -j option of parallel
+ * @p: The parallel run, receiving the number of jobs
+ * @args: The arguments of parallel
+ *
+ * Without -j, one job per online CPU runs at a time. The value must be
+ * a positive number of at most nine digits, so it cannot overflow.
+ * Returns the index of the command, or -1 on an invalid option.
+ */
+
+static int	parse_jobs(t_parallel *p, char **args)
+{
+	char	*value;
+	int		next;
+	int		i;
+
+	p->jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	if (p->jobs < 1)
+		p->jobs = 1;
+	if (!args[1] || ft_strncmp(args[1], "-j", 2) != 0)
+		return (1);
+	value = args[1] + 2;
+	next = 2;
+	if (!*value)
+		value = args[next++];
+	if (!value)
+		return (-1);
+	i = 0;
+	while (ft_isdigit(value[i]))
+		i++;
+	if (value[i] || i == 0 || i > 9)
+		return (-1);
+	p->jobs = ft_atoi(value);
+	if (p->jobs < 1)
+		return (-1);
+	return (next);
+}
+
+/**
+ * parse_parallel - Splits the arguments of parallel
+ * @p: The parallel run, receiving the command and the values
+ * @args: The arguments of parallel
+ *
+ * Returns 0 on success, -1 on a usage error.
+ */
+
+static int	parse_parallel(t_parallel *p, char **args)
+{
+	int	start;
+	int	i;
+
+	start = parse_jobs(p, args);
+	if (start == -1)
+		return (-1);
+	i = start;
+	while (args[i] && ft_strcmp(args[i], ":::") != 0)
+		i++;
+	if (!args[i] || i == start)
+		return (-1);
+	p->args = args + start;
+	p->argc = i - start;
+	p->inputs = args + i + 1;
+	p->count = 0;
+	while (p->inputs[p->count])
+		p->count++;
+	return (0);
+}
+
+/**
+ * builtin_parallel - Runs a command once per value, several at a time
+ * @shell: Shell context
+ * @cmd: "parallel [-j N] command [args] ::: values..."
+ *
+ * Jobs run in the shell's own environment, with no extra process layer
+ * as with xargs -P. SIGINT stops the run instead of being restarted.
+ * Returns the number of failed jobs, capped at 101 like GNU parallel, or
+ * 255 on a usage error.
+ */
+
+int	builtin_parallel(t_shell *shell, t_command *cmd)
+{
+	t_parallel			p;
+	struct sigaction	sa;
+	struct sigaction	old;
+
+	ft_memset(&p, 0, sizeof(t_parallel));
+	p.shell = shell;
+	if (parse_parallel(&p, cmd->args))
+		return (error("parallel", NULL,
+				"usage: parallel [-j N] command [args] ::: values..."), 255);
+	if (p.jobs > p.count && p.count > 0)
+		p.jobs = p.count;
+	p.slots = malloc(sizeof(t_slot) * p.jobs);
+	if (!p.slots)
+		return (error("parallel", NULL, strerror(errno)), 1);
+	ft_memset(p.slots, 0, sizeof(t_slot) * p.jobs);
+	ft_memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = handle_interrupt;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, &old);
+	run_parallel(&p);
+	sigaction(SIGINT, &old, NULL);
+	free(p.slots);
+	if (p.failed > 101)
+		return (101);
+	return (p.failed);
+}
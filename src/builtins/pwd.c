@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 18:47:07 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 18:47:07 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:56:33 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,14 +14,17 @@
 
 /**
  * Built-in command that prints the current working directory
- * Uses PWD environment variable when available to preserve symlinks
+ * Uses PWD environment variable when available to preserve symlinks;
+ * with -P the physical directory is printed instead
  */
-int	builtin_pwd(t_shell *shell)
+int	builtin_pwd(t_shell *shell, t_command *cmd)
 {
 	char	*cwd;
 	char	*env_pwd;
 
 	env_pwd = get_env_value(shell, "PWD");
+	if (cmd->args[1] && ft_strcmp(cmd->args[1], "-P") == 0)
+		env_pwd = NULL;
 	if (env_pwd)
 	{
 		ft_putendl_fd(env_pwd, STDOUT_FILENO);
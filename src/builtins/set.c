@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   set.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:14:02 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:56 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * parse_size - Reads a byte count with an optional K, M or G suffix
+ * @str: The text to read
+ * @size: Receives the number of bytes
+ *
+ * Returns 0 on success, -1 if the text is not a valid size or the size
+ * does not fit in a long.
+ */
+
+static int	parse_size(const char *str, long *size)
+{
+	long	n;
+	int		shift;
+	int		i;
+
+	n = 0;
+	i = 0;
+	while (ft_isdigit(str[i]) && n <= (LONG_MAX >> 31))
+		n = n * 10 + str[i++] - '0';
+	if (i == 0 || ft_isdigit(str[i]))
+		return (-1);
+	shift = 0;
+	if (str[i] == 'K' || str[i] == 'k')
+		shift = 10;
+	else if (str[i] == 'M' || str[i] == 'm')
+		shift = 20;
+	else if (str[i] == 'G' || str[i] == 'g')
+		shift = 30;
+	else if (str[i])
+		return (-1);
+	if ((str[i] && str[i + 1]) || n > (LONG_MAX >> shift))
+		return (-1);
+	*size = n << shift;
+	return (0);
+}
+
+/**
+ * put_size - Writes a byte count, which may not fit in an int
+ * @n: The count
+ * @fd: Where to write it
+ */
+
+static void	put_size(long n, int fd)
+{
+	t_buffer	buf;
+
+	ft_memset(&buf, 0, sizeof(buf));
+	if (!buffer_append_num(&buf, n, 1))
+		write(fd, buf.data, buf.len);
+	free(buf.data);
+}
+
+/**
+ * pipe_max_size - Reads the largest pipe capacity an unprivileged
+ * process may ask for
+ *
+ * Returns the value of /proc/sys/fs/pipe-max-size, or 1 MiB if it
+ * cannot be read.
+ */
+
+static long	pipe_max_size(void)
+{
+	char	buf[32];
+	long	max;
+	ssize_t	len;
+	int		fd;
+
+	max = 0;
+	fd = open("/proc/sys/fs/pipe-max-size", O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (1L << 20);
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return (1L << 20);
+	buf[len] = '\0';
+	if (buf[len - 1] == '\n')
+		buf[len - 1] = '\0';
+	if (parse_size(buf, &max) == -1 || max <= 0)
+		return (1L << 20);
+	return (max);
+}
+
+/**
+ * set_pipesize - Sets the capacity of the pipes between pipeline stages
+ * @shell: Shell context receiving the option
+ * @value: The requested size
+ *
+ * Sizes above /proc/sys/fs/pipe-max-size are clamped to it, so that
+ * every pipe gets the same capacity whatever the privileges of the
+ * shell.
+ * Returns 0 on success, 1 on an invalid size.
+ */
+
+static int	set_pipesize(t_shell *shell, const char *value)
+{
+	long	size;
+	long	max;
+
+	if (parse_size(value, &size) == -1 || size < 0)
+		return (error("set", (char *)value, "invalid pipe size"), 1);
+	max = pipe_max_size();
+	if (size > max)
+	{
+		ft_putstr_fd("minishell: set: pipe size clamped to ", STDERR_FILENO);
+		put_size(max, STDERR_FILENO);
+		ft_putstr_fd(" bytes\n", STDERR_FILENO);
+		size = max;
+	}
+	shell->pipe_size = size;
+	return (0);
+}
+
+/**
+ * builtin_set - Sets or shows shell options
+ * @shell: Shell context holding the options
+ * @cmd: The command and its arguments
+ *
+ * set -o lists the options, set -o pipesize=SIZE sets the capacity of
+ * pipeline pipes and set +o pipesize goes back to the kernel default.
+ * Returns 0 on success, 1 on error.
+ */
+
+int	builtin_set(t_shell *shell, t_command *cmd)
+{
+	char	**args;
+
+	args = cmd->args;
+	if (args[1] && !args[2] && ft_strcmp(args[1], "-o") == 0)
+	{
+		ft_putstr_fd("pipesize\t", STDOUT_FILENO);
+		if (shell->pipe_size > 0)
+			put_size(shell->pipe_size, STDOUT_FILENO);
+		else
+			ft_putstr_fd("default", STDOUT_FILENO);
+		ft_putstr_fd("\n", STDOUT_FILENO);
+		return (0);
+	}
+	if (!args[1] || !args[2] || args[3])
+		return (error("set", NULL, "usage: set [-+]o [pipesize[=SIZE]]"), 1);
+	if (ft_strcmp(args[1], "+o") == 0 && ft_strcmp(args[2], "pipesize") == 0)
+	{
+		shell->pipe_size = 0;
+		return (0);
+	}
+	if (ft_strcmp(args[1], "-o") == 0
+		&& ft_strncmp(args[2], "pipesize=", 9) == 0)
+		return (set_pipesize(shell, args[2] + 9));
+	error("set", args[2], "invalid option name");
+	return (1);
+}
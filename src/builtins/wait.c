@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:50:49 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:52:09 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * find_job - Looks up a job from an argument of wait
+ * @shell: Shell context holding the job table
+ * @spec: "%N" for job number N, or the pid of one of the job's stages
+ *
+ * Returns the job, or NULL if there is no such job.
+ */
+
+static t_job	*find_job(t_shell *shell, char *spec)
+{
+	t_job	*job;
+	int		id;
+	int		i;
+
+	id = ft_atoi(spec + (spec[0] == '%'));
+	job = shell->jobs;
+	while (job)
+	{
+		if (spec[0] == '%' && job->id == id)
+			return (job);
+		i = 0;
+		while (spec[0] != '%' && i < job->count)
+		{
+			if (job->pids[i] == id)
+				return (job);
+			i++;
+		}
+		job = job->next;
+	}
+	return (NULL);
+}
+
+/**
+ * wait_job - Waits for every stage of a job to exit
+ * @job: The job
+ *
+ * Returns the exit status of the job, or 130 if interrupted.
+ */
+
+static int	wait_job(t_job *job)
+{
+	int	status;
+	int	i;
+
+	i = 0;
+	while (job->live && i < job->count)
+	{
+		if (job->status[i] == -1)
+		{
+			status = 0;
+			if (waitpid(job->pids[i], &status, 0) == -1 && errno == EINTR)
+				return (130);
+			job_update(job, job->pids[i], status);
+		}
+		i++;
+	}
+	job->waited = 1;
+	return (job_exit_code(job));
+}
+
+/**
+ * wait_all - Waits for all background jobs
+ * @shell: Shell context holding the job table
+ *
+ * Returns 0 once every job is done, or 130 if interrupted.
+ */
+
+static int	wait_all(t_shell *shell)
+{
+	t_job	*job;
+
+	job = shell->jobs;
+	while (job)
+	{
+		if (wait_job(job) == 130 && job->live)
+			return (130);
+		job = job->next;
+	}
+	return (0);
+}
+
+/**
+ * wait_next - Waits for the next background job to finish
+ * @shell: Shell context holding the job table
+ *
+ * A job that finished since the last prompt and was not waited for yet
+ * is returned right away. Otherwise the shell sleeps in waitpid until a
+ * stage exits, and no polling is involved.
+ * Returns the exit status of the job, 127 if there is no job to wait for.
+ */
+
+static int	wait_next(t_shell *shell)
+{
+	t_job	*job;
+	pid_t	pid;
+	int		status;
+
+	poll_jobs(shell);
+	job = shell->jobs;
+	while (job && (job->live || job->waited))
+		job = job->next;
+	while (!job)
+	{
+		pid = waitpid(-1, &status, 0);
+		if (pid == -1 && errno == EINTR)
+			return (130);
+		if (pid == -1)
+			return (127);
+		job = shell->jobs;
+		while (job && !job_update(job, pid, status))
+			job = job->next;
+		if (job && job->live)
+			job = NULL;
+	}
+	job->waited = 1;
+	return (job_exit_code(job));
+}
+
+/**
+ * builtin_wait - Waits for background jobs
+ * @shell: Shell context holding the job table
+ * @cmd: The command and its arguments
+ *
+ * Supports "wait" for all jobs, "wait ID" for one job and "wait -n" for
+ * the next one to finish. SIGINT interrupts the wait instead of being
+ * restarted.
+ * Returns the exit status of the waited job, 127 for an unknown job.
+ */
+
+int	builtin_wait(t_shell *shell, t_command *cmd)
+{
+	struct sigaction	sa;
+	struct sigaction	old;
+	t_job				*job;
+	int					ret;
+
+	ft_memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = handle_interrupt;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, &old);
+	if (!cmd->args[1])
+		ret = wait_all(shell);
+	else if (!ft_strcmp(cmd->args[1], "-n"))
+		ret = wait_next(shell);
+	else
+	{
+		job = find_job(shell, cmd->args[1]);
+		ret = 127;
+		if (!job)
+			error("wait", cmd->args[1], "no such job");
+		else
+			ret = wait_job(job);
+	}
+	sigaction(SIGINT, &old, NULL);
+	return (ret);
+}
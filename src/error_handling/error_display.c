@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 15:41:13 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 15:41:13 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:18:30 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -128,13 +128,15 @@ void	warning(const char *cmd, const char *warning_item, const char *msg)
  * @exit_code: Exit status code to return
  *
  * Displays an error message and then terminates the shell with the specified
- * exit code after cleaning up resources.
+ * exit code. Only forked children reach this, so they leave through
+ * exit_forked_child() without tearing down the shell's memory.
  */
 void	display_error_and_exit(t_shell *shell, const char *cmd, const char *msg,
 	int exit_code)
 {
+	(void)shell;
 	error(NULL, cmd, msg);
-	clean_and_exit_shell(shell, exit_code);
+	exit_forked_child(exit_code);
 }
 
 /**
@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 15:46:16 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 15:46:16 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:59:23 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -104,8 +104,7 @@ void	free_command(t_command **cmds)
 	while (cmd)
 	{
 		next = cmd->next;
-		if (cmd->args)
-			free_array(cmd->args);
+		free(cmd->assigns);
 		if (cmd->redirs)
 			free_redirs(&cmd->redirs);
 		free(cmd);
@@ -1,70 +1,165 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   builtin_executor.c                                 :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/27 15:41:56 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 15:41:56 by hchowdhu         ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "minishell.h"
-
-/**
- * Checks if command is a shell builtin
- * 
- * @param cmd  Command to check
- * 
- * @return 1 if command is a builtin, 0 otherwise
- * 
- * Supported builtins: cd, echo, env, exit, export, pwd, unset, help
- */
-int	is_builtin(t_command *cmd)
-{
-	if (!cmd || !cmd->args || !cmd->args[0])
-		return (0);
-	if (ft_strcmp(cmd->args[0], "cd") == 0 || \
-		ft_strcmp(cmd->args[0], "echo") == 0 || \
-		ft_strcmp(cmd->args[0], "env") == 0 || \
-		ft_strcmp(cmd->args[0], "exit") == 0 || \
-		ft_strcmp(cmd->args[0], "export") == 0 || \
-		ft_strcmp(cmd->args[0], "pwd") == 0 || \
-		ft_strcmp(cmd->args[0], "unset") == 0 || \
-		ft_strcmp(cmd->args[0], "help") == 0)
-		return (1);
-	return (0);
-}
-
-/**
- * Executes a builtin command
- * 
- * @param shell  Shell context
- * @param cmd    Command to execute
- * 
- * @return Exit status of the builtin command
- * 
- * Routes execution to the appropriate builtin handler function
- * based on the command name.
- */
-int	run_builtin(t_shell *shell, t_command *cmd)
-{
-	if (ft_strcmp(cmd->args[0], "cd") == 0)
-		return (builtin_cd(shell, cmd));
-	else if (ft_strcmp(cmd->args[0], "echo") == 0)
-		return (builtin_echo(cmd));
-	else if (ft_strcmp(cmd->args[0], "env") == 0)
-		return (builtin_env(shell, cmd));
-	else if (ft_strcmp(cmd->args[0], "exit") == 0)
-		return (builtin_exit(shell, cmd));
-	else if (ft_strcmp(cmd->args[0], "export") == 0)
-		return (builtin_export(shell, cmd));
-	else if (ft_strcmp(cmd->args[0], "pwd") == 0)
-		return (builtin_pwd(shell));
-	else if (ft_strcmp(cmd->args[0], "unset") == 0)
-		return (builtin_unset(shell, cmd));
-	else if (ft_strcmp(cmd->args[0], "help") == 0)
-		return (builtin_help(shell));
-	return (1);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_executor.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/27 15:41:56 by hchowdhu          #+#    #+#             */
+/*   Updated: 2026/10/19 08:26:38 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * Checks if command is a shell builtin
+ * 
+ * @param cmd  Command to check
+ * 
+ * @return 1 if command is a builtin, 0 otherwise
+ * 
+ * Supported builtins: cd, echo, env, exit, export, pwd, unset, help,
+ * jobs, wait, parallel, set, pushd, popd, dirs
+ */
+int	is_builtin(t_command *cmd)
+{
+	if (!cmd || !cmd->args || !cmd->args[0])
+		return (0);
+	if (ft_strcmp(cmd->args[0], "cd") == 0 || \
+		ft_strcmp(cmd->args[0], "echo") == 0 || \
+		ft_strcmp(cmd->args[0], "env") == 0 || \
+		ft_strcmp(cmd->args[0], "exit") == 0 || \
+		ft_strcmp(cmd->args[0], "export") == 0 || \
+		ft_strcmp(cmd->args[0], "pwd") == 0 || \
+		ft_strcmp(cmd->args[0], "unset") == 0 || \
+		ft_strcmp(cmd->args[0], "help") == 0 || \
+		ft_strcmp(cmd->args[0], "jobs") == 0 || \
+		ft_strcmp(cmd->args[0], "wait") == 0 || \
+		ft_strcmp(cmd->args[0], "parallel") == 0 || \
+		ft_strcmp(cmd->args[0], "set") == 0 || \
+		ft_strcmp(cmd->args[0], "pushd") == 0 || \
+		ft_strcmp(cmd->args[0], "popd") == 0 || \
+		ft_strcmp(cmd->args[0], "dirs") == 0)
+		return (1);
+	return (0);
+}
+
+/**
+ * Executes one of the job control, option or directory stack builtins
+ * 
+ * @param shell  Shell context
+ * @param cmd    Command to execute
+ * 
+ * @return Exit status of the builtin command
+ */
+static int	run_shell_builtin(t_shell *shell, t_command *cmd)
+{
+	if (ft_strcmp(cmd->args[0], "jobs") == 0)
+		return (builtin_jobs(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "wait") == 0)
+		return (builtin_wait(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "parallel") == 0)
+		return (builtin_parallel(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "set") == 0)
+		return (builtin_set(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "pushd") == 0)
+		return (builtin_pushd(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "popd") == 0)
+		return (builtin_popd(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "dirs") == 0)
+		return (builtin_dirs(shell, cmd));
+	return (1);
+}
+
+/**
+ * Routes execution to the appropriate builtin handler function
+ * 
+ * @param shell  Shell context
+ * @param cmd    Command to execute
+ * 
+ * @return Exit status of the builtin command
+ */
+static int	dispatch_builtin(t_shell *shell, t_command *cmd)
+{
+	if (ft_strcmp(cmd->args[0], "cd") == 0)
+		return (builtin_cd(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "echo") == 0)
+		return (builtin_echo(cmd));
+	else if (ft_strcmp(cmd->args[0], "env") == 0)
+		return (builtin_env(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "exit") == 0)
+		return (builtin_exit(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "export") == 0)
+		return (builtin_export(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "pwd") == 0)
+		return (builtin_pwd(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "unset") == 0)
+		return (builtin_unset(shell, cmd));
+	else if (ft_strcmp(cmd->args[0], "help") == 0)
+		return (builtin_help(shell));
+	return (run_shell_builtin(shell, cmd));
+}
+
+/**
+ * Executes a builtin command
+ * 
+ * @param shell  Shell context
+ * @param cmd    Command to execute
+ * 
+ * @return Exit status of the builtin command
+ * 
+ * The command's prefix assignments are visible to env for as long as it
+ * runs; the shell's own lookups and shell->env itself are left alone.
+ */
+int	run_builtin(t_shell *shell, t_command *cmd)
+{
+	char	**saved;
+	int		status;
+
+	saved = shell->env_overlay;
+	shell->env_overlay = cmd->assigns;
+	status = dispatch_builtin(shell, cmd);
+	shell->env_overlay = saved;
+	return (status);
+}
+
+/**
+ * execute_command_sequence - Execute commands stored in the shell structure
+ * @shell: Shell structure containing commands to execute
+ *
+ * Routes command execution based on command type:
+ * 1. Empty command list: Early return
+ * 2. Redirection-only command: Handle redirections and update exit status
+ * 3. Pipeline (multiple commands), background or timed external command:
+ *    Call pipe execution handler, which records background pipelines as
+ *    jobs and keeps the rusage of timed ones
+ * 4. Single command: Execute directly
+ * 
+ * All commands are freed after execution regardless of success/failure.
+ */
+void	execute_command_sequence(t_shell *shell)
+{
+	t_command	*cmd;
+	int			redir_status;
+
+	cmd = shell->commands;
+	if (!cmd)
+		return (end_background(shell));
+	if (!cmd->args && cmd->redirs && !cmd->next)
+	{
+		redir_status = process_command_redirections(cmd, shell);
+		if (redir_status == -1)
+			g_exit_status = 1;
+		else
+			g_exit_status = 0;
+		free_command(&shell->commands);
+		return (end_background(shell));
+	}
+	if (cmd->next || shell->background || (shell->timing && !is_builtin(cmd)))
+		setup_pipeline_execution(shell, cmd);
+	else
+		execute_non_piped_command(shell, cmd);
+	free_command(&shell->commands);
+	end_background(shell);
+}
@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/11 02:32:18 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 20:00:40 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:59:23 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -48,23 +48,26 @@ static void	check_device_full_error(t_command *cmd)
  * 
  * Resolves command path, validates it's not a directory,
  * closes unnecessary file descriptors, and executes the command.
+ * Prefix assignments apply to the PATH lookup and to the new environment.
  * Exits with appropriate error code on failure.
  */
-static	void	execute_external_command(t_shell *shell, t_command *cmd)
+void	execute_external_command(t_shell *shell, t_command *cmd)
 {
 	char		*exec_path;
 	struct stat	path_stat;
 
+	shell->env_overlay = cmd->assigns;
 	exec_path = get_command_path(shell, cmd);
 	if (stat(exec_path, &path_stat) == 0 && S_ISDIR(path_stat.st_mode))
 	{
 		error(NULL, exec_path, "Is a directory");
-		clean_and_exit_shell(shell, 126);
+		exit_forked_child(126);
 	}
 	cleanup_shell_file_descriptors(shell);
-	execve(exec_path, cmd->args, shell->env);
+	trace_exec(shell);
+	execve(exec_path, cmd->args, exec_environment(shell));
 	error(NULL, exec_path, strerror(errno));
-	clean_and_exit_shell(shell, 126);
+	exit_forked_child(126);
 }
 /**
  * Executes a single command (not part of a pipeline)
@@ -86,17 +89,19 @@ void	execute_non_piped_command(t_shell *shell, t_command *cmd)
 		run_builtin_command(shell, cmd);
 		return ;
 	}
+	trace_phase(shell, TRACE_FORK);
 	child_pid = fork();
+	if (child_pid == 0)
+		setup_and_execute_child_process(shell, cmd);
+	trace_phase(shell, TRACE_WAIT);
 	if (child_pid == -1)
 	{
 		error("fork", NULL, strerror(errno));
 		g_exit_status = 1;
-		return ;
 	}
-	if (child_pid == 0)
-		setup_and_execute_child_process(shell, cmd);
 	else
 		ignore_sigint_and_wait(child_pid);
+	trace_phase(shell, TRACE_RUN);
 }
 
 /**
@@ -138,10 +143,10 @@ void	setup_and_execute_child_process(t_shell *shell, t_command *cmd)
 {
 	reset_signals_to_default();
 	if (process_command_redirections(cmd, shell) == -1)
-		clean_and_exit_shell(shell, 1);
+		exit_forked_child(1);
 	apply_command_redirections(cmd);
 	if (!cmd->args || !cmd->args[0] || \
 		!is_fd_writable(STDOUT_FILENO, cmd->args[0]))
-		clean_and_exit_shell(shell, 1);
+		exit_forked_child(1);
 	execute_external_command(shell, cmd);
 }
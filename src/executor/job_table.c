@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:50:49 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:52:09 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * enter_background - Prepares a child process of a background job
+ * @shell: Shell context, holding the process group of the job
+ * @input_fd: Input of the stage, STDIN_FILENO for the first one
+ *
+ * The child joins the process group of the job, so that signals sent
+ * from the terminal reach the foreground only. A first stage reads
+ * /dev/null instead of the terminal unless it redirects its input.
+ */
+
+void	enter_background(t_shell *shell, int input_fd)
+{
+	int	fd;
+
+	setpgid(0, shell->job_pgid);
+	if (input_fd != STDIN_FILENO)
+		return ;
+	fd = open("/dev/null", O_RDONLY);
+	if (fd == -1)
+		return ;
+	dup2(fd, STDIN_FILENO);
+	close(fd);
+}
+/**
+ * report_job - Prints the final state of a finished job
+ * @job: The job
+ */
+
+static void	report_job(t_job *job)
+{
+	char	*code;
+	char	*state;
+
+	if (job_exit_code(job) == 0)
+	{
+		print_job(job, "Done", "");
+		return ;
+	}
+	code = ft_itoa(job_exit_code(job));
+	if (!code)
+		return ;
+	state = ft_strjoin("Exit ", code);
+	free(code);
+	if (!state)
+		return ;
+	print_job(job, state, "");
+	free(state);
+}
+
+/**
+ * notify_jobs - Reports and forgets the background jobs that finished
+ * @shell: Shell context holding the job table
+ *
+ * Called before each prompt, so that finished jobs are announced
+ * without interrupting the output of the foreground command.
+ */
+
+void	notify_jobs(t_shell *shell)
+{
+	t_job	**link;
+	t_job	*job;
+
+	poll_jobs(shell);
+	link = &shell->jobs;
+	while (*link)
+	{
+		job = *link;
+		if (job->live)
+		{
+			link = &job->next;
+			continue ;
+		}
+		report_job(job);
+		*link = job->next;
+		free(job->status);
+		free(job->command);
+		free(job);
+	}
+}
+
+/**
+ * free_jobs - Frees the whole job table
+ * @shell: Shell context holding the job table
+ *
+ * Jobs still running are left running, as bash does on exit. The pid
+ * arrays belong to the memory manager and are left alone.
+ */
+
+void	free_jobs(t_shell *shell)
+{
+	t_job	*next;
+
+	while (shell->jobs)
+	{
+		next = shell->jobs->next;
+		free(shell->jobs->status);
+		free(shell->jobs->command);
+		free(shell->jobs);
+		shell->jobs = next;
+	}
+	free(shell->job_command);
+	shell->job_command = NULL;
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jobs.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:50:49 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:52:09 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * append_job - Links a new job at the end of the job table
+ * @shell: Shell context holding the job table
+ * @job: The new job
+ *
+ * The job gets the lowest id above the ones in use, like in bash, and
+ * its id and process group are announced on stderr.
+ */
+
+static void	append_job(t_shell *shell, t_job *job)
+{
+	t_job	**link;
+
+	job->id = 1;
+	link = &shell->jobs;
+	while (*link)
+	{
+		job->id = (*link)->id + 1;
+		link = &(*link)->next;
+	}
+	*link = job;
+	ft_putchar_fd('[', STDERR_FILENO);
+	ft_putnbr_fd(job->id, STDERR_FILENO);
+	ft_putstr_fd("] ", STDERR_FILENO);
+	ft_putnbr_fd(job->pgid, STDERR_FILENO);
+	ft_putchar_fd('\n', STDERR_FILENO);
+}
+
+/**
+ * add_job - Records a pipeline launched in the background
+ * @shell: Shell context holding the job table
+ * @pids: Pids of the pipeline stages, kept by the job
+ * @count: Number of stages
+ *
+ * The job takes over the command text saved when the line was read.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	add_job(t_shell *shell, pid_t *pids, int count)
+{
+	t_job	*job;
+
+	job = malloc(sizeof(t_job));
+	if (!job)
+		return (-1);
+	ft_memset(job, 0, sizeof(t_job));
+	job->status = malloc(sizeof(int) * count);
+	if (!job->status)
+		return (free(job), -1);
+	ft_memset(job->status, -1, sizeof(int) * count);
+	job->pids = pids;
+	job->count = count;
+	job->live = count;
+	job->pgid = shell->job_pgid;
+	job->command = shell->job_command;
+	shell->job_command = NULL;
+	append_job(shell, job);
+	return (0);
+}
+
+/**
+ * job_update - Records the exit of one stage of a job
+ * @job: The job
+ * @pid: Pid of the stage that exited
+ * @status: Its wait status
+ *
+ * Returns 1 if the pid belongs to a running stage of the job, 0 otherwise.
+ */
+
+int	job_update(t_job *job, pid_t pid, int status)
+{
+	int	i;
+
+	i = 0;
+	while (i < job->count)
+	{
+		if (job->pids[i] == pid && job->status[i] == -1)
+		{
+			job->status[i] = status;
+			job->live--;
+			return (1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * job_exit_code - Computes the exit status of a finished job
+ * @job: The job
+ *
+ * As for foreground pipelines, the status is the one of the last stage.
+ * Returns the exit status, 128 plus the signal number for a killed stage.
+ */
+
+int	job_exit_code(t_job *job)
+{
+	int	status;
+
+	status = job->status[job->count - 1];
+	if (status == -1)
+		return (0);
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	return (WEXITSTATUS(status));
+}
+
+/**
+ * poll_jobs - Collects the stages of background jobs that have exited
+ * @shell: Shell context holding the job table
+ *
+ * Only the pids of the job table are waited for, never blocking. A stage
+ * that is already gone counts as a successful exit.
+ */
+
+void	poll_jobs(t_shell *shell)
+{
+	t_job	*job;
+	pid_t	ret;
+	int		status;
+	int		i;
+
+	job = shell->jobs;
+	while (job)
+	{
+		i = 0;
+		while (job->live && i < job->count)
+		{
+			status = 0;
+			ret = 0;
+			if (job->status[i] == -1)
+				ret = waitpid(job->pids[i], &status, WNOHANG);
+			if (ret != 0)
+				job_update(job, job->pids[i], status);
+			i++;
+		}
+		job = job->next;
+	}
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_run.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:53:08 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:18:30 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * build_args - Builds the argument vector of one parallel job
+ * @p: The parallel run
+ * @input: The value for this job
+ *
+ * Every "{}" of the command is replaced with the value. Without any,
+ * the value is appended as the last argument.
+ * Returns the NULL-terminated vector, or NULL on allocation failure.
+ */
+
+static char	**build_args(t_parallel *p, char *input)
+{
+	char	**args;
+	int		used;
+	int		i;
+
+	args = malloc(sizeof(char *) * (p->argc + 2));
+	if (!args)
+		return (NULL);
+	used = 0;
+	i = -1;
+	while (++i < p->argc)
+	{
+		args[i] = p->args[i];
+		if (ft_strcmp(args[i], "{}") == 0)
+		{
+			args[i] = input;
+			used = 1;
+		}
+	}
+	args[i] = NULL;
+	if (!used)
+		args[i++] = input;
+	args[i] = NULL;
+	return (args);
+}
+
+/**
+ * parallel_child - Runs one parallel job in a child process
+ * @p: The parallel run
+ * @slot: The slot of the job, holding its output files
+ * @input: The value for this job
+ *
+ * The job writes into its own memory files and reads /dev/null, so jobs
+ * never fight over the terminal.
+ */
+
+static void	parallel_child(t_parallel *p, t_slot *slot, char *input)
+{
+	t_command	cmd;
+	int			fd;
+
+	reset_signals_to_default();
+	if (dup2(slot->out_fd, STDOUT_FILENO) == -1
+		|| dup2(slot->err_fd, STDERR_FILENO) == -1)
+		exit_forked_child(1);
+	fd = open("/dev/null", O_RDONLY);
+	if (fd != -1 && dup2(fd, STDIN_FILENO) != -1)
+		close(fd);
+	ft_memset(&cmd, 0, sizeof(t_command));
+	cmd.fd_in = STDIN_FILENO;
+	cmd.fd_out = STDOUT_FILENO;
+	cmd.args = build_args(p, input);
+	if (!cmd.args)
+		exit_forked_child(1);
+	if (is_builtin(&cmd))
+		exit_forked_child(run_builtin(p->shell, &cmd));
+	execute_external_command(p->shell, &cmd);
+}
+
+/**
+ * start_job - Starts the next parallel job in a free slot
+ * @p: The parallel run
+ *
+ * A job that cannot be started counts as failed.
+ */
+
+static void	start_job(t_parallel *p)
+{
+	t_slot	*slot;
+
+	slot = p->slots;
+	while (slot->pid)
+		slot++;
+	slot->out_fd = memfd_create("minishell-parallel", MFD_CLOEXEC);
+	slot->err_fd = memfd_create("minishell-parallel", MFD_CLOEXEC);
+	if (slot->out_fd != -1 && slot->err_fd != -1)
+		slot->pid = fork();
+	if (slot->out_fd == -1 || slot->err_fd == -1 || slot->pid == -1)
+	{
+		error("parallel", p->inputs[p->next], strerror(errno));
+		if (slot->out_fd != -1)
+			close(slot->out_fd);
+		if (slot->err_fd != -1)
+			close(slot->err_fd);
+		slot->pid = 0;
+		p->failed++;
+	}
+	else if (slot->pid == 0)
+		parallel_child(p, slot, p->inputs[p->next]);
+	else
+		p->running++;
+	p->next++;
+}
+
+/**
+ * finish_job - Prints the output of a finished job and frees its slot
+ * @p: The parallel run
+ * @slot: The slot of the job
+ * @status: Its wait status
+ *
+ * Each output is written with a single write, so the output of two jobs
+ * never interleaves.
+ */
+
+static void	finish_job(t_parallel *p, t_slot *slot, int status)
+{
+	t_buffer	out;
+	int			*fd;
+	int			target;
+
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		p->failed++;
+	fd = &slot->out_fd;
+	target = STDOUT_FILENO;
+	while (target <= STDERR_FILENO)
+	{
+		ft_bzero(&out, sizeof(t_buffer));
+		if (lseek(*fd, 0, SEEK_SET) == 0
+			&& read_subst_output(*fd, &out) == 0 && out.len)
+			write(target, out.data, out.len);
+		free(out.data);
+		close(*fd);
+		fd = &slot->err_fd;
+		target++;
+	}
+	slot->pid = 0;
+	p->running--;
+}
+
+/**
+ * run_parallel - Runs jobs with at most p->jobs of them at a time
+ * @p: The parallel run
+ *
+ * The shell sleeps in waitpid and starts a new job as soon as one exits.
+ * Children that are not parallel jobs are handed to the job table. An
+ * interrupt stops new jobs from starting, running ones are still reaped.
+ */
+
+void	run_parallel(t_parallel *p)
+{
+	t_job	*job;
+	pid_t	pid;
+	int		status;
+	int		i;
+
+	while (p->next < p->count || p->running)
+	{
+		while (p->running < p->jobs && p->next < p->count)
+			start_job(p);
+		if (!p->running)
+			break ;
+		pid = waitpid(-1, &status, 0);
+		if (pid == -1 && errno == EINTR)
+			p->next = p->count;
+		if (pid == -1 && errno != EINTR)
+			break ;
+		i = 0;
+		while (pid > 0 && i < p->jobs && p->slots[i].pid != pid)
+			i++;
+		if (pid > 0 && i < p->jobs)
+			finish_job(p, &p->slots[i], status);
+		job = p->shell->jobs;
+		while (pid > 0 && i == p->jobs && job && !job_update(job, pid, status))
+			job = job->next;
+	}
+}
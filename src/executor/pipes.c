@@ -6,12 +6,27 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/11 02:32:43 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/23 22:04:15 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:59:23 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
+/**
+ * exit_forked_child - Ends a child forked to run one command
+ * @exit_code: Exit status of the child
+ *
+ * The child's copy of the shell dies with it, so walking the managed
+ * memory list only costs time that grows with the parent's heap and
+ * copies pages the parent still shares. Buffered output from builtins
+ * is flushed, then the process leaves without running atexit handlers.
+ */
+void	exit_forked_child(int exit_code)
+{
+	fflush(stdout);
+	_exit(exit_code);
+}
+
 /**
  * execute_external_command_or_exit - 
  * Attempts to execute external command or exits
@@ -25,7 +40,8 @@
  * 
  * Key behaviors:
  * 1. Handles empty command arguments by exiting successfully
- * 2. Searches PATH for executable using command name
+ * 2. Searches PATH for executable using command name, with the command's
+ *    prefix assignments in effect
  * 3. Reports "command not found" with exit code 127 if not found
  * 4. Reports execve errors if the command was found but execution failed
  * 
@@ -37,17 +53,19 @@ static void	execute_external_command_or_exit(t_shell *shell, t_command *cmd)
 	char	*full_cmd;
 
 	if (!cmd->args || !cmd->args[0])
-		clean_and_exit_shell(shell, EXIT_SUCCESS);
+		exit_forked_child(EXIT_SUCCESS);
+	shell->env_overlay = cmd->assigns;
 	full_path = search_path_for_exec(cmd->args[0], shell);
 	if (!full_path)
 	{
 		full_cmd = combine_command_arguments(shell, cmd->args);
 		error(NULL, full_cmd, "command not found");
-		clean_and_exit_shell(shell, 127);
+		exit_forked_child(127);
 	}
-	execve(full_path, cmd->args, shell->env);
+	trace_exec(shell);
+	execve(full_path, cmd->args, exec_environment(shell));
 	error("execve", cmd->args[0], strerror(errno));
-	clean_and_exit_shell(shell, EXIT_SUCCESS);
+	exit_forked_child(EXIT_SUCCESS);
 }
 
 /**
@@ -63,9 +81,12 @@ static void	execute_external_command_or_exit(t_shell *shell, t_command *cmd)
  * 1. Resets signal handlers to default behavior
  * 2. Closes saved file descriptors from parent
  * 3. Sets up stdin/stdout to connect with pipe endpoints
- * 4. Closes all file descriptors not needed by this command
- * 5. Handles command-specific redirections
- * 6. Executes either a builtin or external command
+ * 4. Handles command-specific redirections
+ * 5. Executes either a builtin or external command
+ * 
+ * Every other pipe end is close-on-exec, so nothing here walks the
+ * other commands or the descriptor table, and the child leaves through
+ * exit_forked_child() rather than tearing down the shell's memory.
  * 
  * Never returns (always exits the process with appropriate exit code).
  */
@@ -80,19 +101,18 @@ void	handle_pipe_child(t_shell *shell, t_command *cmd, int input_fd,
 	if (shell->saved_stdout >= 0)
 		close(shell->saved_stdout);
 	if (!cmd)
-		clean_and_exit_shell(shell, EXIT_SUCCESS);
+		exit_forked_child(EXIT_SUCCESS);
 	setup_command_io(cmd, input_fd, pipe_fds);
-	close_unused_command_fds(shell->commands, cmd);
 	if (process_command_redirections(cmd, shell) == -1)
-		clean_and_exit_shell(shell, EXIT_FAILURE);
+		exit_forked_child(EXIT_FAILURE);
 	apply_command_redirections(cmd);
 	if (!cmd->args || !cmd->args[0] || \
 		!is_fd_writable(STDOUT_FILENO, cmd->args[0]))
-		clean_and_exit_shell(shell, 1);
+		exit_forked_child(1);
 	if (is_builtin(cmd))
 	{
 		exit_code = run_builtin(shell, cmd);
-		clean_and_exit_shell(shell, exit_code);
+		exit_forked_child(exit_code);
 	}
 	else
 		execute_external_command_or_exit(shell, cmd);
@@ -103,9 +123,11 @@ void	handle_pipe_child(t_shell *shell, t_command *cmd, int input_fd,
  * @pids: Array of process IDs to wait for
  * @count: Number of processes in the array
  * @last_pid: PID of the last command in the pipeline (determines exit status)
+ * @usage: Array receiving the resource usage of each stage, or NULL
  * 
  * This function waits for all child processes in a pipeline to complete and
- * sets the global exit status based on the last command's result. This mimics
+ * sets the global exit status based on the last command's result. The
+ * rusage of each stage is kept when the pipeline is timed. This mimics
  * how bash handles exit status for pipelines - only the last command's status
  * is returned.
  * 
@@ -113,16 +135,20 @@ void	handle_pipe_child(t_shell *shell, t_command *cmd, int input_fd,
  * - Normal exit: Uses the exit code provided by the process
  * - Signal termination: 128 + signal number
  */
-void	collect_pipeline_exit_status(pid_t *pids, int count, pid_t last_pid)
+void	collect_pipeline_exit_status(pid_t *pids, int count, pid_t last_pid,
+	struct rusage *usage)
 {
-	int	i;
-	int	status;
+	int				i;
+	int				status;
+	struct rusage	ru;
 
 	i = 0;
 	while (i < count)
 	{
-		if (waitpid(pids[i], &status, 0) != -1)
+		if (wait4(pids[i], &status, 0, &ru) != -1)
 		{
+			if (usage)
+				usage[i] = ru;
 			if (pids[i] == last_pid)
 			{
 				if (WIFEXITED(status))
@@ -135,39 +161,6 @@ void	collect_pipeline_exit_status(pid_t *pids, int count, pid_t last_pid)
 	}
 }
 
-/**
- * cleanup_finished_processes - Removes completed processes from system
- * @pids: Array of process IDs to check
- * @count: Number of processes in the array
- * 
- * This function performs a non-blocking wait on some child processes to avoid
- * accumulating too many completed-but-not-removed processes when running large
- * pipelines. It checks approximately 1/4 of the total processes, 
- * with a minimum of 1.
- * 
- * This helps manage system resources when executing complex command chains.
- */
-void	cleanup_finished_processes(pid_t *pids, int count)
-{
-	int	i;
-	int	status;
-	int	waited;
-	int	to_wait;
-
-	i = 0;
-	status = 0;
-	waited = 0;
-	to_wait = count / 4;
-	if (to_wait < 1)
-		to_wait = 1;
-	while (i < count && waited < to_wait)
-	{
-		if (waitpid(pids[i], &status, WNOHANG) > 0)
-			waited++;
-		i++;
-	}
-}
-
 /**
  * execute_pipe - Executes a sequence of commands as a pipeline
  * @shell: Shell context containing environment and settings
@@ -179,7 +172,8 @@ void	cleanup_finished_processes(pid_t *pids, int count)
  * 2. Creates data structure to track pipeline execution state
  * 3. Iterates through all commands in the chain, processing each one
  * 4. Manages file descriptor connections between processes
- * 5. Waits for all processes to complete and collects exit status
+ * 5. Waits for all processes to complete and collects exit status, or
+ *    records them in the job table for a background pipeline
  * 
  * This function implements the core of pipeline handling in the shell,
  * connecting multiple commands with pipes so the output of each command
@@ -190,25 +184,26 @@ void	execute_pipe(t_shell *shell, t_command *cmd, pid_t *pids)
 	int			input_fd;
 	int			fork_count;
 	pid_t		last_pid;
-	int			res;
 	t_pipe_data	data;
 
 	input_fd = STDIN_FILENO;
 	fork_count = 0;
 	last_pid = 0;
-	res = 0;
 	data.input_fd = &input_fd;
 	data.fork_count = &fork_count;
 	data.last_pid = &last_pid;
 	data.pids = pids;
 	while (cmd != NULL)
 	{
-		res = process_single_piped_command(shell, cmd, &data);
-		if (res == 0)
+		if (process_single_piped_command(shell, cmd, &data) == 0)
 			return ;
 		cmd = cmd->next;
 	}
 	if (input_fd != STDIN_FILENO && input_fd != -1)
 		close(input_fd);
-	collect_pipeline_exit_status(pids, fork_count, last_pid);
+	if (shell->background && add_job(shell, pids, fork_count) == 0)
+		return ((void)(g_exit_status = 0));
+	trace_phase(shell, TRACE_WAIT);
+	collect_pipeline_exit_status(pids, fork_count, last_pid,
+		stage_usage(shell));
 }
@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 15:42:22 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 15:42:22 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:14:02 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,10 +57,13 @@ static void	handle_parent_pipe_descriptors(int *input_fd, int pipe_fds[2],
  * 
  * This function is the core of pipeline processing. For each command, it:
  * 1. Creates pipes as needed for command output
- * 2. Periodically waits for processes to avoid excessive forking
- * 3. Forks and executes the command
- * 4. Updates process tracking information
- * 5. Sets up file descriptors for the next command
+ * 2. Forks and executes the command
+ * 3. Updates process tracking information
+ * 4. Sets up file descriptors for the next command
+ * 
+ * Children are only reaped once the whole pipeline is started, so that
+ * the status and usage of every stage are kept. Nothing here depends on
+ * the number of stages, which keeps pipeline setup linear.
  * 
  * Returns: 1 on success, 0 on failure (with proper cleanup)
  */
@@ -70,21 +73,16 @@ int	process_single_piped_command(t_shell *shell, t_command *cmd,
 	int		pipe_fds[2];
 	pid_t	pid;
 
-	if (!create_pipe_if_needed(cmd, pipe_fds))
-	{
-		if (*(data->fork_count) > 0)
-			collect_pipeline_exit_status(data->pids, *(data->fork_count),
-				*(data->last_pid));
-		return (0);
-	}
-	if (*(data->fork_count) > 0 && *(data->fork_count) % 10 == 0)
-		cleanup_finished_processes(data->pids, *(data->fork_count));
-	pid = fork_pipe_child(shell, cmd, *(data->input_fd), pipe_fds);
+	pid = -1;
+	if (create_pipe_if_needed(shell, cmd, pipe_fds))
+		pid = fork_pipe_child(shell, cmd, *(data->input_fd), pipe_fds);
 	if (pid == -1)
 	{
+		if (*(data->input_fd) != STDIN_FILENO && *(data->input_fd) != -1)
+			close(*(data->input_fd));
 		if (*(data->fork_count) > 0)
 			collect_pipeline_exit_status(data->pids, *(data->fork_count),
-				*(data->last_pid));
+				*(data->last_pid), NULL);
 		return (0);
 	}
 	data->pids[*(data->fork_count)] = pid;
@@ -93,30 +91,38 @@ int	process_single_piped_command(t_shell *shell, t_command *cmd,
 	handle_parent_pipe_descriptors(data->input_fd, pipe_fds, cmd);
 	return (1);
 }
+
 /**
  * create_pipe_if_needed - 
  * Creates a pipe only if there's another command in chain
+ * @shell: Shell context holding the pipesize option
  * @cmd: Current command to check if it needs a pipe
  * @pipe_fds: Array to store pipe file descriptors (read/write ends)
  * 
  * This function optimizes pipe creation by only creating pipes when
  * another command follows in the pipeline. It initializes pipe file
- * descriptors to safe values and handles pipe creation errors.
+ * descriptors to safe values and handles pipe creation errors. Pipes
+ * are close-on-exec: a child keeps only the ends it dup2()s onto its
+ * stdin and stdout, so no per-child sweep of descriptors is needed.
+ * When set -o pipesize is in effect the pipe is grown to that capacity;
+ * a refused resize keeps the kernel default rather than failing.
  * 
  * Returns: 1 on success (pipe created or not needed), 0 on pipe creation failure
  */
 
-int	create_pipe_if_needed(t_command *cmd, int pipe_fds[2])
+int	create_pipe_if_needed(t_shell *shell, t_command *cmd, int pipe_fds[2])
 {
 	pipe_fds[0] = -1;
 	pipe_fds[1] = -1;
 	if (cmd->next)
 	{
-		if (pipe(pipe_fds) == -1)
+		if (pipe2(pipe_fds, O_CLOEXEC) == -1)
 		{
 			error("pipe", NULL, strerror(errno));
 			return (0);
 		}
+		if (shell->pipe_size > 0)
+			fcntl(pipe_fds[1], F_SETPIPE_SZ, (int)shell->pipe_size);
 	}
 	return (1);
 }
@@ -132,7 +138,8 @@ int	create_pipe_if_needed(t_command *cmd, int pipe_fds[2])
  * This function forks a child process to execute a command in a pipeline,
  * handles fork errors with proper cleanup, and calls the appropriate
  * handler for the child process. The parent process simply returns the
- * child's pid for tracking.
+ * child's pid for tracking. The stages of a background pipeline share a
+ * process group led by the first one, set on both sides of the fork.
  * 
  * Returns: Child process PID on success, -1 on fork failure
  */
@@ -141,7 +148,9 @@ int	fork_pipe_child(t_shell *shell, t_command *cmd, int input_fd,
 {
 	pid_t	pid;
 
+	trace_phase(shell, TRACE_FORK);
 	pid = fork();
+	trace_phase(shell, TRACE_RUN);
 	if (pid == -1)
 	{
 		error("fork", NULL, strerror(errno));
@@ -152,7 +161,15 @@ int	fork_pipe_child(t_shell *shell, t_command *cmd, int input_fd,
 		return (-1);
 	}
 	if (pid == 0)
+	{
+		if (shell->background)
+			enter_background(shell, input_fd);
 		handle_pipe_child(shell, cmd, input_fd, pipe_fds);
+	}
+	if (shell->background && !shell->job_pgid)
+		shell->job_pgid = pid;
+	if (shell->background)
+		setpgid(pid, shell->job_pgid);
 	return (pid);
 }
 
@@ -166,7 +183,9 @@ int	fork_pipe_child(t_shell *shell, t_command *cmd, int input_fd,
  * 2. Counts the number of commands in the pipeline
  * 3. Allocates memory for tracking process IDs
  * 4. Executes the pipeline commands
- * 5. Ensures proper cleanup of file descriptors
+ * 
+ * The parent closes its pipe ends as it goes, so the saved standard
+ * descriptors stay open for the commands that follow.
  * 
  * Called when the shell detects multiple commands connected by pipes.
  */
@@ -195,5 +214,5 @@ void	setup_pipeline_execution(t_shell *shell, t_command *cmd)
 	}
 	ft_memset(pids, 0, size);
 	execute_pipe(shell, cmd, pids);
-	cleanup_shell_file_descriptors(shell);
+	trace_phase(shell, TRACE_RUN);
 }
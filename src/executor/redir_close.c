@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/26 19:38:41 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/26 19:40:54 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:12:17 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,86 +16,28 @@
  * cleanup_shell_file_descriptors - Close all non-standard file descriptors
  * @shell: Shell structure containing saved standard descriptors
  * 
- * This function closes all open file descriptors from 3 to OPEN_MAX,
- * except for the shell's saved stdin and stdout. After closing
- * non-standard FDs, it also closes and resets the saved standard FDs.
+ * This function closes every file descriptor from 3 up, including the
+ * shell's saved stdin and stdout, which are reset. The trace file is
+ * kept; it is close-on-exec already. close_range() does this in one or
+ * two system calls whatever the size of the descriptor table.
  * 
- * Called during shell cleanup or after pipeline execution to prevent
- * file descriptor leaks.
+ * Called before exec and during shell cleanup to prevent file
+ * descriptor leaks.
  */
 void	cleanup_shell_file_descriptors(t_shell *shell)
 {
-	int	fd;
+	unsigned int	from;
 
-	fd = 3;
-	while (fd < OPEN_MAX)
+	from = 3;
+	if (shell->trace && shell->trace->fd >= 3)
 	{
-		if (fd != shell->saved_stdin && fd != shell->saved_stdout)
-			close(fd);
-		fd++;
-	}
-	if (shell->saved_stdin >= 0)
-	{
-		close(shell->saved_stdin);
-		shell->saved_stdin = -1;
-	}
-	if (shell->saved_stdout >= 0)
-	{
-		close(shell->saved_stdout);
-		shell->saved_stdout = -1;
-	}
-}
-
-/**
- * close_all_non_standard_fds - Close all file descriptors above standard ones
- * 
- * This function closes all file descriptors from 3 to OPEN_MAX,
- * preserving only standard input (0), output (1), and error (2).
- * 
- * Used before exec calls to prevent leaking file descriptors to
- * child processes that don't need them.
- */
-void	close_all_non_standard_fds(void)
-{
-	int	fd;
-
-	fd = 3;
-	while (fd < OPEN_MAX)
-	{
-		close(fd);
-		fd++;
-	}
-}
-
-/**
- * close_unused_command_fds - Close file descriptors for all other commands
- * @all_cmds: Linked list of all commands in the pipeline
- * @current_cmd: The current command being executed
- * 
- * This function walks through the command list and closes input/output
- * file descriptors for all commands except the current one. This prevents
- * descriptor leaks and ensures each command only has access to its own
- * redirections.
- * 
- * Critical for proper pipeline execution to ensure file descriptors
- * aren't exhausted during complex command sequences.
- */
-void	close_unused_command_fds(t_command *all_cmds, t_command *current_cmd)
-{
-	t_command	*cmd;
-
-	cmd = all_cmds;
-	while (cmd)
-	{
-		if (cmd != current_cmd)
-		{
-			if (cmd->fd_in != -1 && cmd->fd_in > 2)
-				close(cmd->fd_in);
-			if (cmd->fd_out != -1 && cmd->fd_out > 2)
-				close(cmd->fd_out);
-		}
-		cmd = cmd->next;
+		if (shell->trace->fd > 3)
+			close_range(3, shell->trace->fd - 1, 0);
+		from = shell->trace->fd + 1;
 	}
+	close_range(from, ~0U, 0);
+	shell->saved_stdin = -1;
+	shell->saved_stdout = -1;
 }
 
 /**
@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/26 19:38:41 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/26 19:40:54 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:12:17 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -82,13 +82,11 @@ void	setup_command_output(t_command *cmd, int pipe_fds[2])
  * This function prepares all file descriptors for a command by:
  * 1. Setting up input redirection
  * 2. Setting up output redirection
- * 3. Closing all other file descriptors to prevent leaks
  */
 void	setup_command_io(t_command *cmd, int input_fd, int pipe_fds[2])
 {
 	setup_command_input(cmd, input_fd);
 	setup_command_output(cmd, pipe_fds);
-	close_all_non_standard_fds();
 }
 
 /**
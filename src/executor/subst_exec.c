@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   subst_exec.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:45:59 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:22:50 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * is_inline_builtin - Checks if a command can be substituted in-process
+ * @cmd: The parsed command
+ *
+ * Only builtins that do nothing but write to stdout qualify, and only
+ * when they have no redirections of their own.
+ * Returns 1 if the command can run without a fork, 0 otherwise.
+ */
+
+int	is_inline_builtin(t_command *cmd)
+{
+	if (!cmd || cmd->next || cmd->redirs || !cmd->args || !cmd->args[0])
+		return (0);
+	if (ft_strcmp(cmd->args[0], "echo") == 0
+		|| ft_strcmp(cmd->args[0], "pwd") == 0
+		|| ft_strcmp(cmd->args[0], "env") == 0
+		|| ft_strcmp(cmd->args[0], "help") == 0)
+		return (1);
+	return (0);
+}
+
+/**
+ * read_subst_output - Reads everything a file descriptor holds
+ * @fd: The file descriptor, read until end of file
+ * @out: The buffer the bytes are appended to
+ *
+ * Reads go straight into the buffer in SUBST_CHUNK sized pieces, the
+ * buffer doubling as needed, so the output is never copied twice.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	read_subst_output(int fd, t_buffer *out)
+{
+	ssize_t	n;
+
+	while (1)
+	{
+		if (buffer_reserve(out, SUBST_CHUNK))
+			return (-1);
+		n = read(fd, out->data + out->len, SUBST_CHUNK);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			break ;
+		out->len += n;
+	}
+	out->data[out->len] = '\0';
+	if (n == -1)
+		return (error("read", NULL, strerror(errno)), -1);
+	return (0);
+}
+
+/**
+ * subst_inline - Runs a builtin with its output captured, without a fork
+ * @shell: Shell context
+ * @cmd: The builtin command
+ * @out: The buffer receiving the output
+ *
+ * Stdout is pointed at an anonymous memory file for the duration of the
+ * builtin, so its output can be of any size.
+ * Returns 0 on success, 1 if no memory file is available, -1 on failure.
+ */
+
+int	subst_inline(t_shell *shell, t_command *cmd, t_buffer *out)
+{
+	int	mem_fd;
+	int	saved;
+	int	ret;
+
+	mem_fd = memfd_create("minishell-subst", MFD_CLOEXEC);
+	if (mem_fd == -1)
+		return (1);
+	saved = dup(STDOUT_FILENO);
+	if (saved == -1 || dup2(mem_fd, STDOUT_FILENO) == -1)
+	{
+		if (saved != -1)
+			close(saved);
+		return (close(mem_fd), 1);
+	}
+	g_exit_status = run_builtin(shell, cmd);
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+	ret = -1;
+	if (lseek(mem_fd, 0, SEEK_SET) == 0)
+		ret = read_subst_output(mem_fd, out);
+	close(mem_fd);
+	return (ret);
+}
+
+/**
+ * subst_child - Runs the substituted command line in a child process
+ * @shell: Shell context
+ * @text: The command line, NULL if it was already parsed
+ * @fds: The capture pipe
+ *
+ * The saved stdout is moved to the pipe too, so that builtins restoring
+ * the standard descriptors keep writing into it. The child leaves with
+ * exit_forked_child, like every other child of the shell.
+ */
+
+static void	subst_child(t_shell *shell, char *text, int *fds)
+{
+	reset_signals_to_default();
+	close(fds[0]);
+	if (dup2(fds[1], STDOUT_FILENO) == -1)
+		exit_forked_child(1);
+	close(fds[1]);
+	close(shell->saved_stdout);
+	shell->saved_stdout = dup(STDOUT_FILENO);
+	shell->background = 0;
+	if (text)
+	{
+		shell->tokens = tokenize_input(text);
+		if (syntax_check(shell))
+			exit_forked_child(2);
+	}
+	execute_command_sequence(shell);
+	exit_forked_child(g_exit_status);
+}
+
+/**
+ * subst_fork - Runs a command line in a child and captures its output
+ * @shell: Shell context
+ * @text: The command line, or NULL to run the already parsed commands
+ * @out: The buffer receiving the output
+ *
+ * Sets the exit status to the one of the child.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	subst_fork(t_shell *shell, char *text, t_buffer *out)
+{
+	int		fds[2];
+	pid_t	pid;
+	int		ret;
+
+	if (pipe(fds) == -1)
+		return (error("pipe", NULL, strerror(errno)), -1);
+	pid = fork();
+	if (pid == -1)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return (error("fork", NULL, strerror(errno)), -1);
+	}
+	if (pid == 0)
+		subst_child(shell, text, fds);
+	close(fds[1]);
+	ret = read_subst_output(fds[0], out);
+	close(fds[0]);
+	ignore_sigint_and_wait(pid);
+	return (ret);
+}
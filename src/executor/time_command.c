@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_command.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:57:26 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:57:26 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * stage_usage - Gives the array receiving the rusage of pipeline stages
+ * @shell: Shell context
+ *
+ * Returns the array when the running line is timed, NULL otherwise.
+ */
+
+struct rusage	*stage_usage(t_shell *shell)
+{
+	if (!shell->timing)
+		return (NULL);
+	return (shell->timing->stages);
+}
+
+/**
+ * start_timing - Takes the starting snapshot of a timed line
+ * @shell: Shell context, its commands about to run
+ * @t: The timing state
+ *
+ * The stage names are copied, since the commands are freed before the
+ * times can be reported.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	start_timing(t_shell *shell, t_timing *t)
+{
+	t_command	*cmd;
+
+	cmd = shell->commands;
+	while (cmd && ++t->count)
+		cmd = cmd->next;
+	t->names = ft_calloc(t->count + 1, sizeof(char *));
+	t->stages = ft_calloc(t->count + 1, sizeof(struct rusage));
+	if (!t->names || !t->stages)
+		return (-1);
+	cmd = shell->commands;
+	t->count = 0;
+	while (cmd)
+	{
+		if (cmd->args && cmd->args[0])
+			t->names[t->count] = ft_strdup(cmd->args[0]);
+		else
+			t->names[t->count] = ft_strdup("");
+		if (!t->names[t->count++])
+			return (-1);
+		cmd = cmd->next;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t->start);
+	getrusage(RUSAGE_SELF, &t->self);
+	return (getrusage(RUSAGE_CHILDREN, &t->children), 0);
+}
+
+/**
+ * stop_timing - Computes the totals of a timed line
+ * @t: The timing state
+ *
+ * CPU times and context switches are the growth of the shell's own and
+ * its children's counters, so builtins are accounted for too. The
+ * maximum resident set size is the largest one of the stages, or the
+ * shell's own when only builtins ran.
+ */
+
+static void	stop_timing(t_timing *t)
+{
+	struct timespec	now;
+	struct rusage	self;
+	struct rusage	children;
+	int				i;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	getrusage(RUSAGE_SELF, &self);
+	getrusage(RUSAGE_CHILDREN, &children);
+	t->real_us = (now.tv_sec - t->start.tv_sec) * 1000000L
+		+ (now.tv_nsec - t->start.tv_nsec) / 1000;
+	t->total.ru_utime.tv_usec = tv_us(self.ru_utime) - tv_us(t->self.ru_utime)
+		+ tv_us(children.ru_utime) - tv_us(t->children.ru_utime);
+	t->total.ru_stime.tv_usec = tv_us(self.ru_stime) - tv_us(t->self.ru_stime)
+		+ tv_us(children.ru_stime) - tv_us(t->children.ru_stime);
+	t->total.ru_nvcsw = self.ru_nvcsw - t->self.ru_nvcsw
+		+ children.ru_nvcsw - t->children.ru_nvcsw;
+	t->total.ru_nivcsw = self.ru_nivcsw - t->self.ru_nivcsw
+		+ children.ru_nivcsw - t->children.ru_nivcsw;
+	i = -1;
+	while (++i < t->count)
+		if (t->stages[i].ru_maxrss > t->total.ru_maxrss)
+			t->total.ru_maxrss = t->stages[i].ru_maxrss;
+	if (!t->total.ru_maxrss)
+		t->total.ru_maxrss = self.ru_maxrss;
+}
+
+/**
+ * run_timed - Runs the commands of a line after the time keyword
+ * @shell: Shell context holding the commands and the timing state
+ *
+ * The times are reported on stderr once the whole pipeline is done.
+ * A background line is run without timing.
+ */
+
+void	run_timed(t_shell *shell)
+{
+	t_timing	*t;
+
+	t = shell->timing;
+	if (shell->background || start_timing(shell, t) == -1)
+	{
+		free_timing(shell);
+		execute_command_sequence(shell);
+		return ;
+	}
+	execute_command_sequence(shell);
+	stop_timing(t);
+	report_timing(shell, t);
+	free_timing(shell);
+}
+
+/**
+ * free_timing - Frees the timing state of a line
+ * @shell: Shell context
+ */
+
+void	free_timing(t_shell *shell)
+{
+	int	i;
+
+	if (!shell->timing)
+		return ;
+	i = 0;
+	while (shell->timing->names && i < shell->timing->count)
+		free(shell->timing->names[i++]);
+	free(shell->timing->names);
+	free(shell->timing->stages);
+	free(shell->timing);
+	shell->timing = NULL;
+}
@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_assign.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:43:14 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:48 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * assign_op - Identifies an assignment operator under the cursor
+ * @ctx: The evaluation state
+ * @op: Set to the binary operator of a compound assignment, -1 for '='
+ *
+ * Returns the length of the assignment operator, 0 if there is none.
+ */
+
+static int	assign_op(t_arith *ctx, int *op)
+{
+	int	len;
+
+	*op = arith_peek_op(ctx);
+	if (*op == AR_BOR || *op == AR_XOR || *op == AR_BAND || *op == AR_SHL
+		|| *op == AR_SHR || *op >= AR_ADD)
+	{
+		len = ft_strlen(arith_op_str(*op));
+		if (ctx->p[len] == '=')
+			return (len + 1);
+	}
+	*op = -1;
+	if (ctx->p[0] == '=' && ctx->p[1] != '=')
+		return (1);
+	return (0);
+}
+
+/**
+ * ternary - Evaluates a conditional expression
+ * @ctx: The evaluation state
+ *
+ * The branch that is not taken is parsed in skip mode.
+ * Returns the value of the expression.
+ */
+
+static int64_t	ternary(t_arith *ctx)
+{
+	int64_t	cond;
+	int64_t	yes;
+	int64_t	no;
+
+	cond = arith_binary(ctx, 1);
+	arith_skip_spaces(ctx);
+	if (ctx->error != AR_OK || *ctx->p != '?')
+		return (cond);
+	ctx->p++;
+	ctx->skip += !cond;
+	yes = arith_assign(ctx);
+	ctx->skip -= !cond;
+	arith_skip_spaces(ctx);
+	if (*ctx->p != ':')
+		return (arith_fail(ctx, AR_ERR_SYNTAX));
+	ctx->p++;
+	ctx->skip += !!cond;
+	no = arith_assign(ctx);
+	ctx->skip -= !!cond;
+	if (cond)
+		return (yes);
+	return (no);
+}
+
+/**
+ * arith_assign - Evaluates an assignment or a conditional expression
+ * @ctx: The evaluation state
+ *
+ * Assignments are right associative. A compound assignment such as +=
+ * reads the variable, applies the operator and stores the result.
+ * Returns the value of the expression.
+ */
+
+int64_t	arith_assign(t_arith *ctx)
+{
+	const char	*name;
+	int64_t		value;
+	int			len;
+	int			op_len;
+	int			op;
+
+	arith_skip_spaces(ctx);
+	name = ctx->p;
+	len = arith_name_len(name);
+	ctx->p += len;
+	op_len = 0;
+	if (len)
+		op_len = assign_op(ctx, &op);
+	if (!op_len)
+	{
+		ctx->p = name;
+		return (ternary(ctx));
+	}
+	ctx->p += op_len;
+	value = arith_assign(ctx);
+	if (op >= 0)
+		value = arith_apply(ctx, op, arith_read_var(ctx, name, len), value);
+	arith_store(ctx, name, len, value);
+	return (value);
+}
+
+/**
+ * arith_comma - Evaluates a comma-separated list of expressions
+ * @ctx: The evaluation state
+ *
+ * Returns the value of the last expression.
+ */
+
+int64_t	arith_comma(t_arith *ctx)
+{
+	int64_t	value;
+
+	value = arith_assign(ctx);
+	arith_skip_spaces(ctx);
+	while (ctx->error == AR_OK && *ctx->p == ',')
+	{
+		ctx->p++;
+		value = arith_assign(ctx);
+		arith_skip_spaces(ctx);
+	}
+	return (value);
+}
+
+/**
+ * arith_run - Evaluates a whole expression
+ * @ctx: The evaluation state, its cursor at the start of the expression
+ *
+ * An empty expression is worth 0. Anything left after the expression is
+ * a syntax error.
+ * Returns the value of the expression.
+ */
+
+int64_t	arith_run(t_arith *ctx)
+{
+	int64_t	value;
+
+	arith_skip_spaces(ctx);
+	if (!*ctx->p)
+		return (0);
+	value = arith_comma(ctx);
+	arith_skip_spaces(ctx);
+	if (*ctx->p)
+		return (arith_fail(ctx, AR_ERR_SYNTAX));
+	return (value);
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_binary.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:43:14 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:48 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * arith_prec - Returns the precedence of a binary operator
+ * @op: The operator
+ *
+ * Higher values bind tighter, following the C operator table.
+ */
+
+int	arith_prec(int op)
+{
+	static const int	prec[AR_OP_COUNT] = {1, 2, 3, 4, 5, 6, 6, 7, 7, 8,
+		8, 7, 7, 9, 9, 10, 10, 10};
+
+	return (prec[op]);
+}
+
+/**
+ * apply_compare - Applies a bitwise or comparison operator
+ * @op: The operator
+ * @a: The left operand
+ * @b: The right operand
+ *
+ * Returns the result of the operation.
+ */
+
+static int64_t	apply_compare(int op, int64_t a, int64_t b)
+{
+	if (op == AR_BOR)
+		return (a | b);
+	if (op == AR_XOR)
+		return (a ^ b);
+	if (op == AR_BAND)
+		return (a & b);
+	if (op == AR_EQ)
+		return (a == b);
+	if (op == AR_NE)
+		return (a != b);
+	if (op == AR_LE)
+		return (a <= b);
+	if (op == AR_GE)
+		return (a >= b);
+	if (op == AR_LT)
+		return (a < b);
+	return (a > b);
+}
+
+/**
+ * arith_apply - Applies a binary operator to two values
+ * @ctx: The evaluation state
+ * @op: The operator
+ * @a: The left operand
+ * @b: The right operand
+ *
+ * Addition, subtraction, multiplication and shifts wrap around like
+ * unsigned 64-bit integers instead of overflowing. Dividing by zero is an
+ * error, unless the expression is being skipped by a short circuit.
+ * Returns the result of the operation.
+ */
+
+int64_t	arith_apply(t_arith *ctx, int op, int64_t a, int64_t b)
+{
+	if ((op == AR_DIV || op == AR_MOD) && b == 0)
+	{
+		if (ctx->skip)
+			return (0);
+		return (arith_fail(ctx, AR_ERR_DIV));
+	}
+	if (op == AR_ADD)
+		return ((uint64_t)a + (uint64_t)b);
+	if (op == AR_SUB)
+		return ((uint64_t)a - (uint64_t)b);
+	if (op == AR_MUL)
+		return ((uint64_t)a * (uint64_t)b);
+	if ((op == AR_DIV || op == AR_MOD) && b == -1)
+		return ((op == AR_DIV) * (0 - (uint64_t)a));
+	if (op == AR_DIV)
+		return (a / b);
+	if (op == AR_MOD)
+		return (a % b);
+	if (op == AR_SHL)
+		return ((uint64_t)a << (b & 63));
+	if (op == AR_SHR)
+		return (a >> (b & 63));
+	return (apply_compare(op, a, b));
+}
+
+/**
+ * logical - Evaluates the right side of a && or || operator
+ * @ctx: The evaluation state
+ * @op: AR_AND or AR_OR
+ * @lhs: Value of the left side
+ *
+ * When the left side already decides the result, the right side is
+ * still parsed but evaluated in skip mode, so it has no side effect.
+ * Returns 0 or 1.
+ */
+
+static int64_t	logical(t_arith *ctx, int op, int64_t lhs)
+{
+	int64_t	rhs;
+	int		short_circuit;
+
+	short_circuit = ((op == AR_AND) == !lhs);
+	ctx->skip += short_circuit;
+	rhs = arith_binary(ctx, arith_prec(op) + 1);
+	ctx->skip -= short_circuit;
+	if (op == AR_AND)
+		return (lhs && rhs);
+	return (lhs || rhs);
+}
+
+/**
+ * arith_binary - Parses and evaluates a chain of binary operators
+ * @ctx: The evaluation state
+ * @min_prec: Lowest precedence the chain may use
+ *
+ * Precedence climbing: operators binding tighter than the current one are
+ * handled by the recursive call on the right side.
+ * Returns the value of the chain.
+ */
+
+int64_t	arith_binary(t_arith *ctx, int min_prec)
+{
+	int64_t	lhs;
+	int64_t	rhs;
+	int		op;
+
+	lhs = arith_unary(ctx);
+	op = arith_peek_op(ctx);
+	while (ctx->error == AR_OK && op >= 0 && arith_prec(op) >= min_prec)
+	{
+		ctx->p += ft_strlen(arith_op_str(op));
+		if (op == AR_OR || op == AR_AND)
+			lhs = logical(ctx, op, lhs);
+		else
+		{
+			rhs = arith_binary(ctx, arith_prec(op) + 1);
+			lhs = arith_apply(ctx, op, lhs, rhs);
+		}
+		op = arith_peek_op(ctx);
+	}
+	return (lhs);
+}
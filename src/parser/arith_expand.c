@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:43:14 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:48 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * arith_format - Formats a 64-bit integer in decimal
+ * @n: The number
+ * @digits: A buffer of at least 21 bytes, usually on the caller's stack
+ *
+ * Returns a pointer to the first character of the number in the buffer.
+ */
+
+char	*arith_format(int64_t n, char *digits)
+{
+	uint64_t	u;
+	int			i;
+
+	u = n;
+	if (n < 0)
+		u = 0 - u;
+	i = 20;
+	digits[i] = '\0';
+	digits[--i] = '0' + u % 10;
+	u /= 10;
+	while (u)
+	{
+		digits[--i] = '0' + u % 10;
+		u /= 10;
+	}
+	if (n < 0)
+		digits[--i] = '-';
+	return (digits + i);
+}
+
+/**
+ * arith_report - Prints an arithmetic error
+ * @expr: The expression
+ * @code: The error
+ *
+ * Returns -1 so that the whole command line is dropped.
+ */
+
+static int	arith_report(char *expr, t_arith_error code)
+{
+	if (code == AR_ERR_DIV)
+		error(NULL, expr, "division by 0");
+	else if (code == AR_ERR_DEPTH)
+		error(NULL, expr, "expression recursion level exceeded");
+	else if (code == AR_ERR_SYNTAX)
+		error(NULL, expr, "syntax error in expression");
+	g_exit_status = 1;
+	return (-1);
+}
+
+/**
+ * evaluate_expr - Expands and evaluates the text of a $((...)) group
+ * @data: Pointer to the shell data structure
+ * @expr: The text between the double parentheses
+ * @n: Set to the value of the expression
+ *
+ * Returns 0 on success, -1 on failure.
+ */
+
+static int	evaluate_expr(t_shell *data, char *expr, int64_t *n)
+{
+	t_arith	ctx;
+	char	*text;
+
+	if (expand_word(data, expr, &text))
+		return (-1);
+	ft_bzero(&ctx, sizeof(t_arith));
+	ctx.shell = data;
+	ctx.p = text;
+	*n = arith_run(&ctx);
+	if (ctx.error != AR_OK)
+	{
+		arith_report(text, ctx.error);
+		free(text);
+		return (-1);
+	}
+	free(text);
+	return (0);
+}
+
+/**
+ * expand_arith - Expands a $((...)) group
+ * @data: Pointer to the shell data structure
+ * @result: Pointer to the result string to append to
+ * @value: The string being expanded
+ * @i: Pointer to the index of the '$', moved past the group
+ *
+ * The expression is evaluated in-process with 64-bit integers and the
+ * result is formatted on the stack before being appended.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	expand_arith(t_shell *data, char **result, char *value, int *i)
+{
+	char	digits[24];
+	char	*expr;
+	int64_t	n;
+	int		end;
+
+	end = skip_word_char(value, *i);
+	if (end == *i + 1 || value[end - 2] != ')')
+	{
+		error(NULL, value + *i, "syntax error in expression");
+		g_exit_status = 1;
+		return (-1);
+	}
+	expr = ft_substr(value, *i + 3, end - *i - 5);
+	*i = end;
+	if (!expr)
+		return (-1);
+	if (evaluate_expr(data, expr, &n))
+		return (free(expr), -1);
+	free(expr);
+	return (add_text(result, arith_format(n, digits)));
+}
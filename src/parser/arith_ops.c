@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:43:14 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:48 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * arith_fail - Records an arithmetic error
+ * @ctx: The evaluation state
+ * @error: The error, only the first one is kept
+ *
+ * Returns 0, the value used for anything evaluated after an error.
+ */
+
+int64_t	arith_fail(t_arith *ctx, t_arith_error error)
+{
+	if (ctx->error == AR_OK)
+		ctx->error = error;
+	return (0);
+}
+
+/**
+ * arith_skip_spaces - Moves the cursor past blanks
+ * @ctx: The evaluation state
+ */
+
+void	arith_skip_spaces(t_arith *ctx)
+{
+	while (*ctx->p == ' ' || *ctx->p == '\t' || *ctx->p == '\n')
+		ctx->p++;
+}
+
+/**
+ * arith_name_len - Measures the variable name at the start of a string
+ * @p: The string
+ *
+ * Returns the length of the name, 0 if the string does not start with one.
+ */
+
+int	arith_name_len(const char *p)
+{
+	int	len;
+
+	if (!ft_isalpha(p[0]) && p[0] != '_')
+		return (0);
+	len = 1;
+	while (ft_isalnum(p[len]) || p[len] == '_')
+		len++;
+	return (len);
+}
+
+/**
+ * arith_op_str - Returns the spelling of a binary operator
+ * @op: The operator
+ *
+ * Two-character operators come before their one-character prefixes, so
+ * that the first match found by arith_peek_op is the longest one.
+ */
+
+const char	*arith_op_str(int op)
+{
+	static const char	*ops[AR_OP_COUNT] = {"||", "&&", "|", "^", "&",
+		"==", "!=", "<=", ">=", "<<", ">>", "<", ">", "+", "-", "*", "/",
+		"%"};
+
+	return (ops[op]);
+}
+
+/**
+ * arith_peek_op - Identifies the binary operator under the cursor
+ * @ctx: The evaluation state
+ *
+ * The cursor is only moved past leading blanks.
+ * Returns the operator, or -1 if there is none.
+ */
+
+int	arith_peek_op(t_arith *ctx)
+{
+	const char	*op;
+	int			i;
+
+	arith_skip_spaces(ctx);
+	i = 0;
+	while (i < AR_OP_COUNT)
+	{
+		op = arith_op_str(i);
+		if (ctx->p[0] == op[0] && (!op[1] || ctx->p[1] == op[1]))
+			return (i);
+		i++;
+	}
+	return (-1);
+}
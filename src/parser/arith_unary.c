@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_unary.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:43:14 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:48 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * variable_operand - Evaluates a variable and its postfix ++ or --
+ * @ctx: The evaluation state, its cursor on the name
+ * @len: Length of the name
+ *
+ * Returns the value of the variable before any postfix update.
+ */
+
+static int64_t	variable_operand(t_arith *ctx, int len)
+{
+	const char	*name;
+	int64_t		value;
+
+	name = ctx->p;
+	ctx->p += len;
+	value = arith_read_var(ctx, name, len);
+	arith_skip_spaces(ctx);
+	if ((ctx->p[0] == '+' || ctx->p[0] == '-') && ctx->p[1] == ctx->p[0])
+	{
+		if (ctx->p[0] == '+')
+			arith_store(ctx, name, len, (uint64_t)value + 1);
+		else
+			arith_store(ctx, name, len, (uint64_t)value - 1);
+		ctx->p += 2;
+	}
+	return (value);
+}
+
+/**
+ * primary - Evaluates a constant, a variable or a parenthesized expression
+ * @ctx: The evaluation state
+ *
+ * Returns the value of the operand.
+ */
+
+static int64_t	primary(t_arith *ctx)
+{
+	int64_t	value;
+	int		len;
+
+	arith_skip_spaces(ctx);
+	if (*ctx->p == '(')
+	{
+		ctx->p++;
+		value = arith_comma(ctx);
+		arith_skip_spaces(ctx);
+		if (*ctx->p != ')')
+			return (arith_fail(ctx, AR_ERR_SYNTAX));
+		ctx->p++;
+		return (value);
+	}
+	if (ft_isdigit(*ctx->p))
+		return (arith_number(ctx));
+	len = arith_name_len(ctx->p);
+	if (len == 0)
+		return (arith_fail(ctx, AR_ERR_SYNTAX));
+	return (variable_operand(ctx, len));
+}
+
+/**
+ * prefix_update - Evaluates a prefix ++ or -- on a variable
+ * @ctx: The evaluation state, its cursor past the operator
+ * @delta: 1 for ++, -1 for --
+ *
+ * Returns the updated value.
+ */
+
+static int64_t	prefix_update(t_arith *ctx, int delta)
+{
+	const char	*name;
+	int64_t		value;
+	int			len;
+
+	arith_skip_spaces(ctx);
+	len = arith_name_len(ctx->p);
+	if (len == 0)
+		return (arith_fail(ctx, AR_ERR_SYNTAX));
+	name = ctx->p;
+	ctx->p += len;
+	value = (uint64_t)arith_read_var(ctx, name, len) + delta;
+	arith_store(ctx, name, len, value);
+	return (value);
+}
+
+/**
+ * unary - Evaluates the unary operators in front of an operand
+ * @ctx: The evaluation state
+ *
+ * Returns the value of the operand once the operators are applied.
+ */
+
+static int64_t	unary(t_arith *ctx)
+{
+	char	op;
+	int64_t	value;
+
+	arith_skip_spaces(ctx);
+	op = *ctx->p;
+	if ((op == '+' || op == '-') && ctx->p[1] == op)
+	{
+		ctx->p += 2;
+		if (op == '+')
+			return (prefix_update(ctx, 1));
+		return (prefix_update(ctx, -1));
+	}
+	if (op != '+' && op != '-' && op != '!' && op != '~')
+		return (primary(ctx));
+	ctx->p++;
+	value = arith_unary(ctx);
+	if (op == '-')
+		return (0 - (uint64_t)value);
+	if (op == '!')
+		return (!value);
+	if (op == '~')
+		return (~value);
+	return (value);
+}
+
+/**
+ * arith_unary - Evaluates an operand with its unary operators
+ * @ctx: The evaluation state
+ *
+ * Every nested parenthesis or unary operator goes through here, which
+ * bounds the recursion depth of the evaluator.
+ * Returns the value of the operand.
+ */
+
+int64_t	arith_unary(t_arith *ctx)
+{
+	int64_t	value;
+
+	if (ctx->error != AR_OK)
+		return (0);
+	if (++ctx->depth > ARITH_MAX_DEPTH)
+		return (arith_fail(ctx, AR_ERR_DEPTH));
+	value = unary(ctx);
+	ctx->depth--;
+	return (value);
+}
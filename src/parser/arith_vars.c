@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_vars.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:43:14 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:48 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * env_lookup_len - Finds a variable from a name that is not terminated
+ * @shell: Pointer to the shell structure
+ * @name: Start of the name inside the expression
+ * @len: Length of the name
+ *
+ * Returns a pointer to the value inside the environment, or NULL.
+ */
+
+static char	*env_lookup_len(t_shell *shell, const char *name, int len)
+{
+	int	i;
+
+	i = 0;
+	while (shell->env && shell->env[i])
+	{
+		if (!ft_strncmp(shell->env[i], name, len)
+			&& shell->env[i][len] == '=')
+			return (shell->env[i] + len + 1);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * arith_read_var - Evaluates a variable used in an expression
+ * @ctx: The evaluation state
+ * @name: Start of the name inside the expression
+ * @len: Length of the name
+ *
+ * The value is read in place from the environment and evaluated as an
+ * expression itself, an unset or empty variable counting as 0.
+ * Returns the value of the variable.
+ */
+
+int64_t	arith_read_var(t_arith *ctx, const char *name, int len)
+{
+	t_arith	sub;
+	char	*value;
+	int64_t	result;
+
+	value = env_lookup_len(ctx->shell, name, len);
+	if (!value || !*value)
+		return (0);
+	sub = *ctx;
+	sub.p = value;
+	result = arith_run(&sub);
+	if (sub.error != AR_OK)
+		return (arith_fail(ctx, sub.error));
+	return (result);
+}
+
+/**
+ * arith_store - Assigns the result of an expression to a variable
+ * @ctx: The evaluation state
+ * @name: Start of the name inside the expression
+ * @len: Length of the name
+ * @value: The value to store
+ *
+ * The number is formatted in a stack buffer and handed straight to the
+ * environment. Nothing is stored while a short circuit skips the
+ * expression or after an error.
+ */
+
+void	arith_store(t_arith *ctx, const char *name, int len, int64_t value)
+{
+	char	digits[24];
+	char	*var;
+
+	if (ctx->skip || ctx->error != AR_OK)
+		return ;
+	var = ft_substr(name, 0, len);
+	if (!var)
+	{
+		arith_fail(ctx, AR_ERR_MEMORY);
+		return ;
+	}
+	update_env(ctx->shell, var, arith_format(value, digits));
+	free(var);
+}
+
+/**
+ * digit_value - Returns the value of a digit in bases up to 16
+ * @c: The character
+ *
+ * Returns the value, or -1 if the character is not a digit.
+ */
+
+static int	digit_value(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'f')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'F')
+		return (c - 'A' + 10);
+	return (-1);
+}
+
+/**
+ * arith_number - Parses an integer constant
+ * @ctx: The evaluation state, its cursor on the first digit
+ *
+ * Accepts decimal, octal with a leading 0 and hexadecimal with a leading
+ * 0x. Values wrap around on overflow.
+ * Returns the value of the constant.
+ */
+
+int64_t	arith_number(t_arith *ctx)
+{
+	uint64_t	value;
+	int			base;
+	int			digit;
+
+	base = 10;
+	if (ctx->p[0] == '0' && (ctx->p[1] == 'x' || ctx->p[1] == 'X'))
+	{
+		base = 16;
+		ctx->p += 2;
+	}
+	else if (ctx->p[0] == '0')
+		base = 8;
+	value = 0;
+	digit = digit_value(*ctx->p);
+	while (digit >= 0 && digit < base)
+	{
+		value = value * base + digit;
+		digit = digit_value(*++ctx->p);
+	}
+	if (ft_isalnum(*ctx->p) || *ctx->p == '_')
+		return (arith_fail(ctx, AR_ERR_SYNTAX));
+	return (value);
+}
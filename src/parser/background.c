@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   background.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:50:48 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:58:42 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * last_unquoted - Finds the last non-blank character of a line
+ * @input: The command line
+ *
+ * Returns its index, or -1 if the line is blank or ends inside quotes.
+ */
+
+static int	last_unquoted(char *input)
+{
+	int		i;
+	int		end;
+	char	quote;
+
+	i = -1;
+	end = -1;
+	quote = 0;
+	while (input[++i])
+	{
+		if (quote && input[i] == quote)
+			quote = 0;
+		else if (!quote && (input[i] == '\'' || input[i] == '"'))
+			quote = input[i];
+		if (!is_whitespace(input[i]))
+			end = i;
+	}
+	if (quote)
+		return (-1);
+	return (end);
+}
+
+/**
+ * take_background - Detects and removes a trailing '&' from a line
+ * @shell: Shell context, receiving the text of the job
+ * @input: The command line, modified in place
+ *
+ * Only an unquoted '&' ending the line counts, '&&' is left to the
+ * syntax checks. The text before it is kept to name the job.
+ * Returns 1 for a background line, 0 otherwise, -1 on allocation failure.
+ */
+
+int	take_background(t_shell *shell, char *input)
+{
+	int	end;
+
+	shell->background = 0;
+	end = last_unquoted(input);
+	if (end < 1 || input[end] != '&' || input[end - 1] == '&')
+		return (0);
+	input[end] = ' ';
+	while (end > 0 && is_whitespace(input[end - 1]))
+		end--;
+	shell->job_command = ft_substr(input, 0, end);
+	if (!shell->job_command)
+		return (-1);
+	shell->background = 1;
+	return (1);
+}
+
+/**
+ * end_background - Resets the background state once a line is done
+ * @shell: Shell context
+ *
+ * Frees the job text if no job took it over, which happens when the
+ * line failed before its pipeline could be launched.
+ */
+
+void	end_background(t_shell *shell)
+{
+	free(shell->job_command);
+	shell->job_command = NULL;
+	shell->background = 0;
+	shell->job_pgid = 0;
+}
@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/26 01:03:32 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 01:05:46 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 05:47:56 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -81,9 +81,14 @@ int	add_variable(char **result, char *value, int start, int end)
 int	check_variable(t_shell *data, char **result, char *value, int *i)
 {
 	char	*var;
-	char	*expanded;
 	int		res;
 
+	if (value[*i + 1] == '{')
+		return (expand_braced(data, result, value, i));
+	if (value[*i + 1] == '(' && value[*i + 2] == '(')
+		return (expand_arith(data, result, value, i));
+	if (value[*i + 1] == '(')
+		return (expand_cmdsub(data, result, value, i));
 	var = extract_variable(value, i);
 	if (!var)
 		return (-1);
@@ -91,14 +96,8 @@ int	check_variable(t_shell *data, char **result, char *value, int *i)
 		res = add_text(result, "$");
 	else if (var[1] && (var[1] == '?' || ft_isdigit(var[1])))
 		res = expand_exit_status(result, var);
-	else if (is_env_variable(data, var))
-	{
-		expanded = expand_value(data->env, var);
-		if (!expanded)
-			return (free(var), -1);
-		res = add_text(result, expanded);
-		free(expanded);
-	}
+	else if (get_env_value(data, var + 1))
+		res = add_text(result, get_env_value(data, var + 1));
 	else if (ft_strcmp(var + 1, "PATH") == 0 && \
 	data->default_path && !data->path_was_unset)
 		res = add_text(result, data->default_path);
@@ -151,6 +150,11 @@ int	potential_expand(char *args, int *i)
 		*i = *i + 2;
 		return (2);
 	}
+	if (args[*i + 1] == '{' || args[*i + 1] == '(')
+	{
+		*i = skip_word_char(args, *i);
+		return (1);
+	}
 	(*i)++;
 	start = *i;
 	while (args[*i] && (ft_isalnum(args[*i]) || args[*i] == '_'))
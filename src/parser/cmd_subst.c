@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_subst.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:45:58 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:02:33 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * parse_here - Checks if a substitution can be parsed by the shell itself
+ * @text: The substituted command line
+ *
+ * Parsing expands the words of the command, so a line holding
+ * expansions that may assign variables, nested substitutions or here-
+ * documents is left to the child process instead.
+ * Returns 1 if the line can be parsed in the current process, 0 otherwise.
+ */
+
+static int	parse_here(char *text)
+{
+	while (*text)
+	{
+		if (*text == '<' || (*text == '$'
+				&& (text[1] == '{' || text[1] == '(')))
+			return (0);
+		text++;
+	}
+	return (1);
+}
+
+/**
+ * is_blank - Checks if a command line holds nothing but spaces
+ * @text: The command line
+ *
+ * Returns 1 if the line is blank, 0 otherwise.
+ */
+
+static int	is_blank(char *text)
+{
+	while (*text == ' ' || *text == '\t' || *text == '\n')
+		text++;
+	return (*text == '\0');
+}
+
+/**
+ * run_parsed - Runs the commands of a substitution parsed in place
+ * @shell: Shell context, its command list holding the commands
+ * @out: The buffer receiving the output
+ *
+ * A plain builtin such as echo or pwd runs without a fork, anything
+ * else is handed to a child process.
+ * Returns 0 on success, -1 on failure.
+ */
+
+static int	run_parsed(t_shell *shell, t_buffer *out)
+{
+	int	ret;
+
+	trace_phase(shell, TRACE_RUN);
+	ret = 1;
+	if (is_inline_builtin(shell->commands))
+		ret = subst_inline(shell, shell->commands, out);
+	if (ret == 1)
+		ret = subst_fork(shell, NULL, out);
+	return (ret);
+}
+
+/**
+ * run_subst - Runs a substituted command line and captures its output
+ * @shell: Shell context
+ * @text: The command line, freed by this function
+ * @out: The buffer receiving the output
+ *
+ * Lines that can be parsed in place are parsed by the shell itself, so
+ * that builtins can skip the fork. The outer token list and the traced
+ * phase are put back afterwards.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	run_subst(t_shell *shell, char *text, t_buffer *out)
+{
+	t_token			*saved;
+	int				ret;
+	t_trace_phase	phase;
+
+	ret = 0;
+	if (is_blank(text) || !parse_here(text))
+	{
+		if (!is_blank(text))
+			ret = subst_fork(shell, text, out);
+		return (free(text), ret);
+	}
+	saved = shell->tokens;
+	phase = trace_phase(shell, TRACE_TOKENIZE);
+	shell->tokens = tokenize_input(text);
+	if (syntax_check(shell))
+		g_exit_status = 2;
+	else if (shell->commands)
+		ret = run_parsed(shell, out);
+	free_command(&shell->commands);
+	shell->tokens = saved;
+	trace_phase(shell, phase);
+	return (ret);
+}
+
+/**
+ * expand_cmdsub - Expands a $(...) group with the output of its command
+ * @data: Pointer to the shell data structure
+ * @result: Pointer to the result string to append to
+ * @value: The string being expanded
+ * @i: Pointer to the index of the '$', moved past the group
+ *
+ * Trailing newlines are dropped by shortening the captured buffer.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	expand_cmdsub(t_shell *data, char **result, char *value, int *i)
+{
+	t_buffer	out;
+	char		*text;
+	int			end;
+	int			ret;
+
+	end = skip_word_char(value, *i);
+	if (end == *i + 1)
+	{
+		error(NULL, value + *i, "unterminated command substitution");
+		g_exit_status = 2;
+		return (-1);
+	}
+	text = ft_substr(value, *i + 2, end - *i - 3);
+	*i = end;
+	if (!text)
+		return (-1);
+	ft_bzero(&out, sizeof(t_buffer));
+	ret = run_subst(data, text, &out);
+	while (ret == 0 && out.len && out.data[out.len - 1] == '\n')
+		out.data[--out.len] = '\0';
+	if (ret == 0 && out.data)
+		ret = add_text(result, out.data);
+	free(out.data);
+	return (ret);
+}
@@ -6,45 +6,12 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/26 00:21:47 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 00:25:26 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:40:12 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
-/**
- * is_token_operator - Checks if the token type is an operator
- * @type: The type of the token to check
- *
- * Returns 1 if the token type is an operator, 0 otherwise.
- */
-
-int	is_cmd(t_token *tokens)
-{
-	if (!tokens->previous)
-		return (1);
-	else if (!is_token_operator(tokens->previous->type))
-		return (1);
-	return (0);
-}
-
-/**
- * fill_words - Fills the args array with the token value
- * @tokens: The token to fill
- * @args: Pointer to the args array to fill
- *
- * Allocates memory for the args array and copies the token value into it.
- * Returns 0 on success, 1 on failure.
- */
-
-int	fill_words(t_token *tokens, char **args)
-{
-	*args = ft_strdup(tokens->value);
-	if (!*args)
-		return (1);
-	return (0);
-}
-
 /**
  * is_operator - Checks if the character at index i is an operator
  * @str: The string to check
@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/26 01:09:17 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 01:10:00 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:59:51 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,7 +21,7 @@
  * to maintain the linked list structure.
  */
 
-static void	link_token_to_list(t_token *current, t_token *new_token)
+void	link_token_to_list(t_token *current, t_token *new_token)
 {
 	new_token->next = current->next;
 	new_token->previous = current;
@@ -31,72 +31,104 @@ static void	link_token_to_list(t_token *current, t_token *new_token)
 }
 
 /**
- * insert_token - Inserts new tokens into the linked list
- *  starting from the current token
- * @current: The current token to start inserting after
- * @words: Array of words to create new tokens from
+ * append_field - Stores one field produced by word splitting
+ * @field: Splitting state (first token, last token, field count)
+ * @str: The expanded string being split
+ * @start: Index of the first byte of the field
+ * @end: Index one past the last byte of the field
  *
- * Creates new tokens for each word in the array and links 
- * them to the current token.
+ * The first field reuses the token being expanded; every following field
+ * gets a new token linked right after the previous one, so the whole split
+ * is a single pass with one allocation per field. Fields stay tokens
+ * rather than argv entries because argv is only built later by the
+ * parser, which still needs them to join words, find redirection targets
+ * and report ambiguous redirections.
  * Returns 0 on success, -1 on failure.
  */
 
-static int	insert_token(t_token *current, char **words)
+static int	append_field(t_field *field, char *str, int start, int end)
 {
-	t_token	*new_token;
 	t_token	*token;
-	int		i;
 
-	token = current;
-	current->ar = 1;
-	i = 1;
-	while (words[i])
+	token = field->current;
+	if (field->count > 0)
 	{
-		new_token = create_token(WORD, words[i]);
-		if (!new_token)
+		token = create_token(WORD, NULL);
+		if (!token)
 			return (-1);
-		new_token->space_before = 1;
-		token->space_after = 1;
-		link_token_to_list(token, new_token);
-		token = new_token;
-		i++;
+		token->space_before = 1;
+		field->last->space_after = 1;
+		link_token_to_list(field->last, token);
+		field->current->ar = 1;
 	}
+	token->value = malloc(end - start + 1);
+	if (!token->value)
+		return (-1);
+	ft_memcpy(token->value, str + start, end - start);
+	token->value[end - start] = '\0';
+	token->split_field = 1;
+	field->last = token;
+	field->count++;
 	return (0);
 }
 
 /**
- * split_tokens - Splits a string into tokens based on spaces
- *  and inserts them into the current token
- * @current: The current token to insert the first word into
- * @str: The string to split into tokens
+ * finish_fields - Restores spacing flags once splitting is done
+ * @field: Splitting state
+ * @trailing: 1 if the expansion ended with a field separator
+ *
+ * The last field inherits the spacing of the original token, and a trailing
+ * separator keeps it from being joined with the word that follows.
+ * An expansion that produced no field leaves an empty token behind,
+ * which is later removed by clean_empty_tokens.
+ * Returns 0 on success, 1 if multiple tokens were created, -1 on failure.
+ */
+
+static int	finish_fields(t_field *field, int trailing)
+{
+	if (field->count == 0)
+	{
+		field->current->value = ft_strdup("");
+		if (!field->current->value)
+			return (-1);
+		return (0);
+	}
+	field->last->space_after = field->space_after || trailing;
+	return (field->count > 1);
+}
+
+/**
+ * split_tokens - Splits an unquoted expansion into fields using IFS
+ * @data: The shell data structure holding the precomputed IFS bitmaps
+ * @current: The token that was expanded
+ * @str: The expanded string to split
  *
- * If the string contains only one word, it duplicates the 
- * string and assigns it to the current token.
- * If there are multiple words, it splits the 
- * string and creates new tokens for each word.
+ * Applies the POSIX field splitting rules: IFS whitespace at both ends is
+ * ignored and runs of it collapse, while each non-whitespace IFS character
+ * delimits a field on its own. Runs in time linear in the length of str.
  * Returns 0 on success, -1 on failure, or 1 if multiple tokens were created.
  */
 
-int	split_tokens(t_token *current, char *str)
+int	split_tokens(t_shell *data, t_token *current, char *str)
 {
-	char	**words;
-	int		word_count;
+	t_field	field;
+	int		i;
+	int		end;
 
-	word_count = count_words_split(str, ' ');
-	if (word_count <= 1)
+	field.current = current;
+	field.last = current;
+	field.count = 0;
+	field.space_after = current->space_after;
+	i = skip_ifs_space(&data->ifs, str, 0);
+	if (i > 0)
+		current->space_before = 1;
+	end = i;
+	while (str[i])
 	{
-		current->value = ft_strdup(str);
-		if (!current->value)
+		end = ifs_field_end(&data->ifs, str, i);
+		if (append_field(&field, str, i, end) == -1)
 			return (-1);
-		return (0);
+		i = skip_ifs_delimiters(&data->ifs, str, end);
 	}
-	words = ft_split(str, ' ');
-	if (!words)
-		return (-1);
-	current->value = ft_strdup(words[0]);
-	if (!current->value)
-		return (free_array(words), -1);
-	if (insert_token(current, words) == -1)
-		return (free_array(words), -1);
-	return (free_array(words), 1);
+	return (finish_fields(&field, i > end));
 }
@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/19 21:34:06 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 01:09:52 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 05:31:06 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -67,39 +67,6 @@ char	*expand_value(char **env, char *dollar)
 	return (free_array(copy_env), free_array(copy_value), NULL);
 }
 
-/** is_whitespace - Checks if a character is a whitespace character
- * @c: The character to check
- *
- * Returns 1 if the character is a whitespace character, 0 otherwise.
- */
-
-static char	*remove_useless_space(char *str)
-{
-	char	*new_line;
-	int		i;
-	int		j;
-
-	new_line = malloc(ft_strlen(str) + 1);
-	if (!new_line)
-		return (NULL);
-	i = 0;
-	j = 0;
-	while (str[i] && is_whitespace(str[i]))
-		i++;
-	while (str[i])
-	{
-		while (str[i] && !is_whitespace(str[i]))
-			new_line[j++] = str[i++];
-		while (str[i] && is_whitespace(str[i]))
-			i++;
-		if (str[i])
-			new_line[j++] = ' ';
-	}
-	new_line[j] = '\0';
-	free(str);
-	return (new_line);
-}
-
 /** expantion - Expands the dollar signs in a token's value
  * @data: The shell data structure containing environment variables
  * @tokens: The token to expand
@@ -127,13 +94,28 @@ int	expantion(t_shell *data, t_token *tokens)
 	free(tokens->value);
 	if (str && !tokens->double_quote)
 	{
-		str = remove_useless_space(str);
-		if (!str)
-			return (-1);
-		if (split_tokens(tokens, str) == -1)
+		if (split_tokens(data, tokens, str) == -1)
 			return (free(str), -1);
 		return (free(str), 1);
 	}
 	tokens->value = str;
 	return (1);
 }
+
+/**
+ * has_glob_chars - Checks if a word contains pattern characters
+ * @str: The word to check
+ *
+ * Returns 1 if the word contains '*', '?' or '[', 0 otherwise.
+ */
+
+int	has_glob_chars(const char *str)
+{
+	while (*str)
+	{
+		if (*str == '*' || *str == '?' || *str == '[')
+			return (1);
+		str++;
+	}
+	return (0);
+}
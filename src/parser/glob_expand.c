@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_expand.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:30:13 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:30:13 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * is_glob_candidate - Checks if a token must go through pathname expansion
+ * @token: The token to check
+ *
+ * Only unquoted words are expanded. Redirection targets and heredoc
+ * delimiters are left untouched.
+ * Returns 1 if the token should be expanded, 0 otherwise.
+ */
+
+static int	is_glob_candidate(t_token *token)
+{
+	if (token->type != WORD || !token->value)
+		return (0);
+	if (token->single_quote || token->double_quote || token->quoted_outside)
+		return (0);
+	if (token->previous && token->previous->type != PIPE
+		&& is_token_operator(token->previous->type))
+		return (0);
+	return (has_glob_chars(token->value));
+}
+
+/**
+ * add_glob_match - Appends a path to the list of matches
+ * @glob: The pathname expansion state
+ * @path: The matching path, owned by the list on success
+ *
+ * The list grows geometrically so collecting n matches stays linear.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	add_glob_match(t_glob *glob, char *path)
+{
+	char	**grown;
+	int		capacity;
+
+	if (glob->count == glob->capacity)
+	{
+		capacity = glob->capacity * 2 + 16;
+		grown = malloc(sizeof(char *) * capacity);
+		if (!grown)
+			return (free(path), -1);
+		if (glob->count)
+			ft_memcpy(grown, glob->matches, sizeof(char *) * glob->count);
+		free(glob->matches);
+		glob->matches = grown;
+		glob->capacity = capacity;
+	}
+	glob->matches[glob->count++] = path;
+	return (0);
+}
+
+/**
+ * insert_matches - Replaces a pattern token with the matching paths
+ * @token: The token holding the pattern
+ * @glob: The sorted list of matches
+ *
+ * The first match reuses the token, every other match gets a new token
+ * linked right after the previous one. Match strings handed over to a
+ * token are cleared from the list so the caller only frees the rest.
+ * Returns 0 on success, 1 on failure.
+ */
+
+static int	insert_matches(t_token *token, t_glob *glob)
+{
+	t_token	*field;
+	int		space_after;
+	int		i;
+
+	space_after = token->space_after;
+	free(token->value);
+	token->value = glob->matches[0];
+	glob->matches[0] = NULL;
+	i = 1;
+	while (i < glob->count)
+	{
+		field = create_token(WORD, NULL);
+		if (!field)
+			return (1);
+		field->value = glob->matches[i];
+		glob->matches[i++] = NULL;
+		field->space_before = 1;
+		token->space_after = 1;
+		link_token_to_list(token, field);
+		token = field;
+	}
+	token->space_after = space_after;
+	return (0);
+}
+
+/**
+ * expand_glob_token - Runs pathname expansion on a single token
+ * @data: Pointer to the shell data structure
+ * @token: The token holding the pattern
+ *
+ * A pattern that matches nothing is left as it is.
+ * Returns 0 on success, 1 on failure.
+ */
+
+static int	expand_glob_token(t_shell *data, t_token *token)
+{
+	t_glob	glob;
+	int		ret;
+
+	ft_memset(&glob, 0, sizeof(t_glob));
+	glob.shell = data;
+	ret = glob_segments(&glob, "", token->value);
+	if (ret == 0 && glob.count > 0)
+	{
+		sort_strings(glob.matches, glob.count);
+		ret = insert_matches(token, &glob);
+	}
+	while (glob.count > 0)
+		free(glob.matches[--glob.count]);
+	free(glob.matches);
+	if (ret)
+		return (1);
+	return (0);
+}
+
+/**
+ * expand_globs - Performs pathname expansion on the command line
+ * @data: Pointer to the shell data structure
+ *
+ * Every directory read while matching is cached for the rest of the
+ * command line, so several patterns on the same directory only list it
+ * once. The cache is dropped before returning.
+ * Returns 0 on success, 1 on failure.
+ */
+
+int	expand_globs(t_shell *data)
+{
+	t_token	*token;
+	t_token	*next;
+
+	token = data->tokens;
+	while (token)
+	{
+		next = token->next;
+		if (is_glob_candidate(token) && expand_glob_token(data, token))
+		{
+			free_dir_cache(data);
+			return (1);
+		}
+		token = next;
+	}
+	free_dir_cache(data);
+	return (0);
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_walk.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:30:13 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:33:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * join_path - Builds a path from a directory prefix and an entry name
+ * @base: The directory prefix, empty or ending with '/'
+ * @name: The entry name
+ * @slash: 1 to append a trailing '/', 0 otherwise
+ *
+ * Returns the newly allocated path, or NULL on allocation failure.
+ */
+
+static char	*join_path(char *base, char *name, int slash)
+{
+	char	*path;
+	size_t	base_len;
+	size_t	name_len;
+
+	base_len = ft_strlen(base);
+	name_len = ft_strlen(name);
+	path = malloc(base_len + name_len + slash + 1);
+	if (!path)
+		return (NULL);
+	ft_memcpy(path, base, base_len);
+	ft_memcpy(path + base_len, name, name_len);
+	if (slash)
+		path[base_len + name_len] = '/';
+	path[base_len + name_len + slash] = '\0';
+	return (path);
+}
+
+/**
+ * literal_segment - Handles a path segment without pattern characters
+ * @glob: The pathname expansion state
+ * @base: The directory prefix matched so far
+ * @segment: The literal segment
+ * @rest: The '/' that follows the segment, or NULL for the last one
+ *
+ * Literal segments are appended without reading the directory. The last
+ * one only needs to exist.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	literal_segment(t_glob *glob, char *base, char *segment,
+	char *rest)
+{
+	struct stat	st;
+	char		*path;
+	int			ret;
+
+	path = join_path(base, segment, rest != NULL);
+	if (!path)
+		return (-1);
+	if (rest)
+	{
+		ret = glob_segments(glob, path, rest + 1);
+		free(path);
+		return (ret);
+	}
+	if (lstat(path, &st) == 0)
+		return (add_glob_match(glob, path));
+	free(path);
+	return (0);
+}
+
+/**
+ * skip_entry - Checks if a directory entry cannot match a segment
+ * @dir: The cached listing
+ * @i: Index of the entry
+ * @pat: The compiled segment
+ * @rest: The '/' that follows the segment, or NULL for the last one
+ *
+ * Hidden entries only match a segment that starts with a '.'. When more
+ * segments follow, entries known not to be directories are skipped
+ * without being opened.
+ * Returns 1 if the entry must be skipped, 0 otherwise.
+ */
+
+static int	skip_entry(t_dir_cache *dir, int i, t_pattern *pat, char *rest)
+{
+	if (dir->names[i][0] == '.' && (!pat->prefix || pat->literals[0] != '.'))
+		return (1);
+	if (rest && dir->types[i] != DT_DIR && dir->types[i] != DT_LNK
+		&& dir->types[i] != DT_UNKNOWN)
+		return (1);
+	return (!pattern_match(pat, dir->names[i], ft_strlen(dir->names[i])));
+}
+
+/**
+ * wild_segment - Matches a path segment against a directory listing
+ * @glob: The pathname expansion state
+ * @base: The directory prefix matched so far
+ * @pat: The compiled segment
+ * @rest: The '/' that follows the segment, or NULL for the last one
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	wild_segment(t_glob *glob, char *base, t_pattern *pat, char *rest)
+{
+	t_dir_cache	*dir;
+	char		*path;
+	int			i;
+
+	dir = get_dir_listing(glob->shell, base);
+	if (!dir)
+		return (-1);
+	i = -1;
+	while (++i < dir->count)
+	{
+		if (skip_entry(dir, i, pat, rest))
+			continue ;
+		path = join_path(base, dir->names[i], rest != NULL);
+		if (!path)
+			return (-1);
+		if (!rest && add_glob_match(glob, path))
+			return (-1);
+		if (rest && glob_segments(glob, path, rest + 1))
+			return (free(path), -1);
+		if (rest)
+			free(path);
+	}
+	return (0);
+}
+
+/**
+ * glob_segments - Expands a pattern one path segment at a time
+ * @glob: The pathname expansion state
+ * @base: The directory prefix matched so far, empty for the current one
+ * @pattern: The remaining pattern
+ *
+ * Each segment holding pattern characters is compiled once and matched
+ * against every entry of its directory.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	glob_segments(t_glob *glob, char *base, char *pattern)
+{
+	t_pattern	pat;
+	char		*slash;
+	char		*segment;
+	int			ret;
+
+	slash = ft_strchr(pattern, '/');
+	if (slash)
+		segment = ft_substr(pattern, 0, slash - pattern);
+	else
+		segment = ft_strdup(pattern);
+	if (!segment)
+		return (-1);
+	if (!has_glob_chars(segment))
+		ret = literal_segment(glob, base, segment, slash);
+	else if (pattern_compile(&pat, segment) == 0)
+	{
+		ret = wild_segment(glob, base, &pat, slash);
+		pattern_free(&pat);
+	}
+	else
+		ret = -1;
+	free(segment);
+	return (ret);
+}
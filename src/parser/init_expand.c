@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/26 00:55:18 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 01:06:41 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 05:47:56 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -46,7 +46,8 @@ int	count_dollars(char *args)
 	{
 		if (args[i] == '$' && args[i + 1] && args[i + 1] != '\0'
 			&& (ft_isalnum(args[i + 1]) || args[i + 1] == '_'
-				|| args[i + 1] == '?'))
+				|| args[i + 1] == '?' || args[i + 1] == '{'
+				|| args[i + 1] == '('))
 		{
 			if (potential_expand(args, &i))
 				j++;
@@ -82,9 +83,9 @@ int	expand_arguments(t_shell *data, t_token *tokens, char **str)
 		if (tokens->value[i] == '$')
 		{
 			if (add_variable(&result, tokens->value, start, i) == -1)
-				return (-1);
+				return (free(result), -1);
 			if (check_variable(data, &result, tokens->value, &i) == -1)
-				return (-1);
+				return (free(result), -1);
 			start = i;
 		}
 		else
@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 18:47:24 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 18:47:24 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:40:12 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -29,18 +29,22 @@ int	count_pipe(t_shell *data)
 	return (i);
 }
 
-int	count_words(t_shell *data)
+int	count_words(t_shell *data, size_t *bytes)
 {
 	t_token	*token;
 	int		word_nb;
 
 	token = data->tokens;
 	word_nb = 0;
+	*bytes = 0;
 	while (token && token->type != PIPE && token->type != T_EOF)
 	{
 		if (token->type == WORD
 			&& (!token->previous || !is_token_operator(token->previous->type)))
+		{
 			word_nb++;
+			*bytes += ft_strlen(token->value) + 1;
+		}
 		token = token->next;
 	}
 	return (word_nb);
@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/26 21:40:54 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 00:41:31 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 05:47:56 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -31,17 +31,13 @@ static void	unsupported_symbols(char **unsupported_symbols)
 	unsupported_symbols[i++] = "&";
 	unsupported_symbols[i++] = "(";
 	unsupported_symbols[i++] = ")";
-	unsupported_symbols[i++] = "[";
-	unsupported_symbols[i++] = "]";
 	unsupported_symbols[i++] = "[[";
 	unsupported_symbols[i++] = "]]";
 	unsupported_symbols[i++] = "((";
 	unsupported_symbols[i++] = "))";
-	unsupported_symbols[i++] = "*";
 	unsupported_symbols[i++] = "\\";
 	unsupported_symbols[i++] = "~";
 	unsupported_symbols[i++] = "#";
-	unsupported_symbols[i++] = "$(";
 	unsupported_symbols[i++] = "$[";
 }
 
@@ -77,6 +73,38 @@ static int	symbols_error(t_token **tokens, char *symbol)
 	return (0);
 }
 
+/**
+ * find_unsupported - Looks for an unsupported symbol in a word
+ * @value: The word to check
+ * @symbols: The unsupported symbols
+ *
+ * ${...}, $(...) and $((...)) groups are skipped, their content is checked
+ * when expanded.
+ * Returns the first unsupported symbol found, or NULL if there is none.
+ */
+
+static char	*find_unsupported(char *value, char **symbols)
+{
+	int	i;
+	int	j;
+	int	next;
+
+	i = 0;
+	while (value[i])
+	{
+		next = skip_word_char(value, i);
+		j = 0;
+		while (next == i + 1 && j < 15)
+		{
+			if (!ft_strncmp(value + i, symbols[j], ft_strlen(symbols[j])))
+				return (symbols[j]);
+			j++;
+		}
+		i = next;
+	}
+	return (NULL);
+}
+
 /**
  * check_unsupported_character - Checks for unsupported characters in tokens
  * @tokens: Pointer to the list of tokens
@@ -90,8 +118,8 @@ static int	symbols_error(t_token **tokens, char *symbol)
 int	check_unsupported_character(t_token **tokens)
 {
 	t_token	*token;
-	char	*symbols[19];
-	int		i;
+	char	*symbols[15];
+	char	*found;
 
 	unsupported_symbols(symbols);
 	token = *tokens;
@@ -99,16 +127,12 @@ int	check_unsupported_character(t_token **tokens)
 	{
 		if (token->type == WORD && token->value && !is_quoted(token))
 		{
-			i = 0;
-			while (i < 19)
+			found = find_unsupported(token->value, symbols);
+			if (found)
 			{
-				if (ft_strstr(token->value, symbols[i]))
-				{
-					if (symbols_error(tokens, symbols[i]) == -1)
-						return (1);
-					return (check_token_error(tokens));
-				}
-				i++;
+				if (symbols_error(tokens, found) == -1)
+					return (1);
+				return (check_token_error(tokens));
 			}
 		}
 		token = token->next;
@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/26 21:39:18 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 00:22:11 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:02:33 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -146,7 +146,8 @@ static int	join_empty_token(t_token **tokens)
  * joining adjacent tokens,
  * joining raw words,
  * joining empty tokens,
- * joining quoted strings, and joining tokens without spaces.
+ * joining quoted strings, joining tokens without spaces,
+ * and pathname expansion of the resulting unquoted words.
  * * Returns 0 on success, or 1 if any operation fails.
  */
 
@@ -154,6 +155,7 @@ int	process_and_join_tokens(t_shell *data)
 {
 	t_token	**token;
 
+	trace_phase(data, TRACE_EXPAND);
 	token = &(data->tokens);
 	if (expand_token(data))
 		return (1);
@@ -169,5 +171,7 @@ int	process_and_join_tokens(t_shell *data)
 		return (1);
 	if (join_no_space(token))
 		return (1);
+	if (expand_globs(data))
+		return (1);
 	return (0);
 }
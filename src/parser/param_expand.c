@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:38:47 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:47:56 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * group_end - Finds the end of a bracketed group
+ * @str: The word
+ * @j: Index of the opening bracket
+ * @open: The opening bracket
+ * @close: The closing bracket
+ *
+ * Quoted text inside the group does not count towards the balance.
+ * Returns the index right after the group, or -1 if it is not closed.
+ */
+
+static int	group_end(const char *str, int j, char open, char close)
+{
+	int		depth;
+	char	quote;
+
+	depth = 0;
+	quote = 0;
+	while (str[j])
+	{
+		if (quote && str[j] == quote)
+			quote = 0;
+		else if (!quote && (str[j] == '\'' || str[j] == '"'))
+			quote = str[j];
+		else if (!quote && str[j] == open)
+			depth++;
+		else if (!quote && str[j] == close && --depth == 0)
+			return (j + 1);
+		j++;
+	}
+	return (-1);
+}
+
+/**
+ * skip_word_char - Steps over one character of a word
+ * @str: The word
+ * @i: Index of the current character
+ *
+ * A ${...}, $(...) or $((...)) group is stepped over as a whole,
+ * brackets being balanced, so that the lexer and the syntax checks never
+ * look inside it.
+ * Returns the index of the next character to look at.
+ */
+
+int	skip_word_char(const char *str, int i)
+{
+	int	end;
+
+	if (str[i] != '$' || (str[i + 1] != '{' && str[i + 1] != '('))
+		return (i + 1);
+	if (str[i + 1] == '{')
+		end = group_end(str, i + 1, '{', '}');
+	else
+		end = group_end(str, i + 1, '(', ')');
+	if (end == -1)
+		return (i + 1);
+	return (end);
+}
+
+/**
+ * bad_substitution - Reports a malformed ${...} group
+ * @value: The string holding the group
+ * @start: Index of the '$'
+ * @end: Index right after the group
+ *
+ * Returns -1 so that the whole command line is dropped.
+ */
+
+static int	bad_substitution(char *value, int start, int end)
+{
+	char	*group;
+
+	group = ft_substr(value, start, end - start);
+	if (!group)
+		return (-1);
+	error(NULL, group, "bad substitution");
+	free(group);
+	g_exit_status = 1;
+	return (-1);
+}
+
+/**
+ * expand_braced - Expands a ${...} group
+ * @data: Pointer to the shell data structure
+ * @result: Pointer to the result string to append to
+ * @value: The string being expanded
+ * @i: Pointer to the index of the '$', moved past the group
+ *
+ * Returns 0 on success, -1 on a malformed group or allocation failure.
+ */
+
+int	expand_braced(t_shell *data, char **result, char *value, int *i)
+{
+	t_param	param;
+	char	*body;
+	char	*out;
+	int		end;
+	int		ret;
+
+	end = skip_word_char(value, *i);
+	if (end == *i + 1)
+		return (bad_substitution(value, *i, ft_strlen(value)));
+	body = ft_substr(value, *i + 2, end - *i - 3);
+	if (!body)
+		return (-1);
+	out = NULL;
+	ret = parse_param(body, &param);
+	free(body);
+	if (ret == 1)
+		ret = bad_substitution(value, *i, end);
+	if (ret == 0)
+		ret = apply_param(data, &param, &out);
+	if (ret == 0)
+		ret = add_text(result, out);
+	free(out);
+	free_param(&param);
+	*i = end;
+	return (ret);
+}
@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:38:47 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:51:19 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * expand_word - Expands the word that follows a ${...} operator
+ * @data: Pointer to the shell data structure
+ * @word: The word, which may hold further expansions
+ * @out: Pointer to the newly allocated expanded word
+ *
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	expand_word(t_shell *data, char *word, char **out)
+{
+	t_token	token;
+
+	if (!count_dollars(word))
+	{
+		*out = ft_strdup(word);
+		if (!*out)
+			return (-1);
+		return (0);
+	}
+	ft_bzero(&token, sizeof(t_token));
+	token.value = word;
+	return (expand_arguments(data, &token, out));
+}
+
+/**
+ * apply_default - Handles the ${VAR:-word}, ${VAR:=word} and ${VAR:+word}
+ * operators
+ * @data: Pointer to the shell data structure
+ * @param: The parameter
+ * @out: Pointer to the newly allocated result
+ *
+ * When the parameter is unset or empty the word is used instead, and
+ * with ':=' it is also assigned to the variable. ':+' works the other way
+ * round, using the word only when the parameter is set and not empty.
+ * Returns 0 on success, -1 on failure.
+ */
+
+static int	apply_default(t_shell *data, t_param *param, char **out)
+{
+	if ((param->op == '+') != (param->value && param->value[0]))
+	{
+		if (param->op == '+')
+			*out = ft_strdup("");
+		else
+			*out = ft_strdup(param->value);
+		if (!*out)
+			return (-1);
+		return (0);
+	}
+	if (expand_word(data, param->word, out))
+		return (-1);
+	if (param->op == '=' && (ft_isalpha(param->name[0])
+			|| param->name[0] == '_'))
+		update_env(data, param->name, *out);
+	return (0);
+}
+
+/**
+ * apply_pattern_op - Handles the trimming and replacement operators
+ * @data: Pointer to the shell data structure
+ * @param: The parameter
+ * @out: Pointer to the newly allocated result
+ *
+ * Returns 0 on success, -1 on failure.
+ */
+
+static int	apply_pattern_op(t_shell *data, t_param *param, char **out)
+{
+	char	*pattern;
+	char	*rep;
+	char	*slash;
+	int		ret;
+
+	rep = NULL;
+	slash = NULL;
+	if (param->op == '/')
+		slash = ft_strchr(param->word, '/');
+	if (slash)
+		*slash = '\0';
+	if (expand_word(data, param->word, &pattern))
+		return (-1);
+	if (param->op != '/')
+		ret = trim_param(param, pattern, NULL, out);
+	else if (slash && expand_word(data, slash + 1, &rep))
+		ret = -1;
+	else if (param->anchor)
+		ret = trim_param(param, pattern, rep, out);
+	else
+		ret = replace_param(param, pattern, rep, out);
+	free(pattern);
+	free(rep);
+	return (ret);
+}
+
+/**
+ * apply_param - Evaluates a parsed ${...} group
+ * @data: Pointer to the shell data structure
+ * @param: The parameter
+ * @out: Pointer to the newly allocated result
+ *
+ * Apart from the default operators, an unset parameter is treated as
+ * an empty one.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	apply_param(t_shell *data, t_param *param, char **out)
+{
+	if (lookup_param(data, param))
+		return (-1);
+	if (param->op == '-' || param->op == '=' || param->op == '+')
+		return (apply_default(data, param, out));
+	if (!param->value)
+		param->value = ft_strdup("");
+	if (!param->value)
+		return (-1);
+	if (param->op == '#' || param->op == '%' || param->op == '/')
+		return (apply_pattern_op(data, param, out));
+	if (param->op == ':')
+		return (substring_param(param, out));
+	if (param->op == 'L')
+		*out = ft_itoa(ft_strlen(param->value));
+	else
+		*out = ft_strdup(param->value);
+	if (!*out)
+		return (-1);
+	return (0);
+}
+
+/**
+ * substring_param - Handles the ${VAR:offset} and ${VAR:offset:length}
+ * operators
+ * @param: The parameter
+ * @out: Pointer to the newly allocated result
+ *
+ * A negative offset counts from the end of the value, a negative length
+ * marks where the substring stops, counted from the end as well.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	substring_param(t_param *param, char **out)
+{
+	char	*colon;
+	int		len;
+	int		off;
+	int		count;
+
+	len = ft_strlen(param->value);
+	off = ft_atoi(param->word);
+	if (off < 0)
+		off += len;
+	if (off < 0 || off > len)
+		off = len;
+	count = len - off;
+	colon = ft_strchr(param->word, ':');
+	if (colon && ft_atoi(colon + 1) < 0)
+		count = len + ft_atoi(colon + 1) - off;
+	else if (colon && ft_atoi(colon + 1) < count)
+		count = ft_atoi(colon + 1);
+	if (count < 0)
+		count = 0;
+	*out = ft_substr(param->value, off, count);
+	if (!*out)
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_parse.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:38:47 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:51:19 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * parse_name - Reads the parameter name of a ${...} group
+ * @body: The text between the braces
+ * @param: The parameter to fill
+ *
+ * A leading '#' asks for the length of the parameter.
+ * Returns the index right after the name, 0 if there is no valid name,
+ * or -1 on allocation failure.
+ */
+
+static int	parse_name(char *body, t_param *param)
+{
+	int	start;
+	int	i;
+
+	start = 0;
+	if (body[0] == '#' && body[1])
+	{
+		param->op = 'L';
+		start = 1;
+	}
+	i = start;
+	if (body[i] == '?' || body[i] == '#' || ft_isdigit(body[i]))
+		i++;
+	else
+	{
+		while (ft_isalpha(body[i]) || body[i] == '_'
+			|| (i > start && ft_isdigit(body[i])))
+			i++;
+	}
+	if (i == start)
+		return (0);
+	param->name = ft_substr(body, start, i - start);
+	if (!param->name)
+		return (-1);
+	return (i);
+}
+
+/**
+ * strip_quotes - Removes quoting from the word of a ${...} group
+ * @word: The word, modified in place
+ *
+ * The lexer keeps ${...} groups whole, quotes included, so they are
+ * removed here before the word is expanded.
+ */
+
+static void	strip_quotes(char *word)
+{
+	char	quote;
+	int		i;
+	int		j;
+
+	quote = 0;
+	i = 0;
+	j = 0;
+	while (word[i])
+	{
+		if (!quote && (word[i] == '\'' || word[i] == '"'))
+			quote = word[i];
+		else if (quote && word[i] == quote)
+			quote = 0;
+		else
+			word[j++] = word[i];
+		i++;
+	}
+	word[j] = '\0';
+}
+
+/**
+ * parse_param - Splits a ${...} group into name, operator and word
+ * @body: The text between the braces
+ * @param: The parameter to fill
+ *
+ * Doubled '#', '%' and '/' operators set the longest flag, and a '#' or
+ * '%' right after a '/' anchors the replacement to the start or the end
+ * of the value; a ':' with nothing after it is malformed, as in bash.
+ * Returns 0 on success, 1 on a malformed group, -1 on allocation failure.
+ */
+
+int	parse_param(char *body, t_param *param)
+{
+	int	i;
+
+	ft_bzero(param, sizeof(t_param));
+	i = parse_name(body, param);
+	if (i < 0)
+		return (-1);
+	if (i == 0)
+		return (1);
+	if (!body[i])
+		return (0);
+	if (param->op == 'L' || (body[i] == ':' && !body[i + 1]))
+		return (1);
+	if (body[i] == ':' && ft_strchr("-=+", body[i + 1]))
+		i++;
+	else if (!ft_strchr(":#%/", body[i]))
+		return (1);
+	param->op = body[i];
+	param->longest = (ft_strchr("#%/", body[i]) && body[i + 1] == body[i]);
+	i += param->longest;
+	if (param->op == '/' && body[i + 1] && ft_strchr("#%", body[i + 1]))
+		param->anchor = body[++i];
+	param->word = ft_strdup(body + i + 1);
+	if (!param->word)
+		return (-1);
+	return (strip_quotes(param->word), 0);
+}
+
+/**
+ * lookup_param - Fetches the current value of a parameter
+ * @data: Pointer to the shell data structure
+ * @param: The parameter, its value left NULL when it is unset
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	lookup_param(t_shell *data, t_param *param)
+{
+	char	*value;
+
+	if (param->name[0] == '?')
+		param->value = ft_itoa(g_exit_status);
+	else if (param->name[0] == '#')
+		param->value = ft_strdup("0");
+	else if (ft_isdigit(param->name[0]))
+		return (0);
+	else
+	{
+		value = get_env_value(data, param->name);
+		if (!value && !ft_strcmp(param->name, "PATH")
+			&& !data->path_was_unset)
+			value = data->default_path;
+		if (!value)
+			return (0);
+		param->value = ft_strdup(value);
+	}
+	if (!param->value)
+		return (-1);
+	return (0);
+}
+
+/**
+ * free_param - Releases the strings held by a parameter
+ * @param: The parameter
+ */
+
+void	free_param(t_param *param)
+{
+	free(param->name);
+	free(param->value);
+	free(param->word);
+}
@@ -0,0 +1,197 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_trim.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:38:47 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:51:19 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * match_span - Finds how many bytes at one end of a string match a pattern
+ * @pat: The compiled pattern
+ * @str: The string
+ * @len: Length of the string
+ * @mode: TRIM_LONGEST for the longest match, TRIM_SUFFIX to match the
+ * end of the string instead of its start
+ *
+ * Candidate lengths shorter than the pattern's minimum are never tried,
+ * and a pattern without stars can only match its exact length, so a
+ * single candidate is checked.
+ * Returns the matched length, or -1 if nothing matches.
+ */
+
+static int	match_span(t_pattern *pat, const char *str, int len, int mode)
+{
+	int	k;
+	int	step;
+	int	off;
+
+	k = pat->min_len;
+	step = 1;
+	if (mode & TRIM_LONGEST)
+	{
+		k = len;
+		step = -1;
+	}
+	if (!pat->has_star)
+		k = pat->min_len;
+	while (k >= pat->min_len && k <= len)
+	{
+		off = 0;
+		if (mode & TRIM_SUFFIX)
+			off = len - k;
+		if (pattern_match(pat, str + off, k))
+			return (k);
+		if (!pat->has_star)
+			break ;
+		k += step;
+	}
+	return (-1);
+}
+
+/**
+ * trim_param - Handles the ${VAR#pat}, ${VAR##pat}, ${VAR%pat} and
+ * ${VAR%%pat} operators, and the anchored ${VAR/#pat/rep} and
+ * ${VAR/%pat/rep} replacements
+ * @param: The parameter
+ * @pattern: The expanded pattern
+ * @rep: What the match is replaced with, NULL to only remove it
+ * @out: Pointer to the newly allocated result
+ *
+ * An anchored replacement takes the longest match at its end of the
+ * value, which may be empty; without a match the value is kept whole.
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	trim_param(t_param *param, char *pattern, char *rep, char **out)
+{
+	t_pattern	pat;
+	char		*keep;
+	int			suffix;
+	int			k;
+
+	suffix = (param->op == '%' || param->anchor == '%');
+	if (pattern_compile(&pat, pattern))
+		return (-1);
+	k = match_span(&pat, param->value, ft_strlen(param->value),
+			(param->longest || param->anchor) | (TRIM_SUFFIX * suffix));
+	pattern_free(&pat);
+	if (k < 0 || !rep)
+		rep = "";
+	if (k < 0)
+		k = 0;
+	keep = ft_substr(param->value, k * !suffix,
+			ft_strlen(param->value) - k);
+	if (suffix)
+		*out = ft_strjoin(keep, rep);
+	else
+		*out = ft_strjoin(rep, keep);
+	free(keep);
+	if (!*out)
+		return (-1);
+	return (0);
+}
+
+/**
+ * next_candidate - Finds the next position where a pattern may match
+ * @pat: The compiled pattern
+ * @str: The string
+ * @i: First position to try
+ * @len: Length of the string
+ *
+ * A pattern that starts with a literal can only match where that byte
+ * appears, so the positions in between are skipped with memchr.
+ * Returns the position, or len if there is none.
+ */
+
+static int	next_candidate(t_pattern *pat, const char *str, int i, int len)
+{
+	const char	*hit;
+
+	if (!pat->prefix)
+		return (i);
+	hit = ft_memchr(str + i, pat->literals[0], len - i);
+	if (!hit)
+		return (len);
+	return (hit - str);
+}
+
+/**
+ * replace_matches - Copies a value, replacing the matches of a pattern
+ * @pat: The compiled pattern
+ * @param: The parameter, its longest flag asking for every match
+ * @rep: The replacement
+ * @buf: The buffer receiving the result
+ *
+ * At each position the longest match wins. Only non-empty matches are
+ * replaced.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	replace_matches(t_pattern *pat, t_param *param, char *rep,
+	t_buffer *buf)
+{
+	int	len;
+	int	i;
+	int	k;
+
+	len = ft_strlen(param->value);
+	i = 0;
+	while (i < len)
+	{
+		k = next_candidate(pat, param->value, i, len);
+		if (buffer_append(buf, param->value + i, k - i))
+			return (-1);
+		i = k;
+		if (i < len)
+			k = match_span(pat, param->value + i, len - i, TRIM_LONGEST);
+		if (i < len && k <= 0 && buffer_append(buf, param->value + i++, 1))
+			return (-1);
+		if (i >= len || k <= 0)
+			continue ;
+		if (buffer_append(buf, rep, ft_strlen(rep)))
+			return (-1);
+		if (!param->longest)
+			return (buffer_append(buf, param->value + i + k, len - i - k));
+		i += k;
+	}
+	return (0);
+}
+
+/**
+ * replace_param - Handles the ${VAR/pat/rep} and ${VAR//pat/rep} operators
+ * @param: The parameter
+ * @pattern: The expanded pattern
+ * @rep: The expanded replacement, NULL when it is omitted
+ * @out: Pointer to the newly allocated result
+ *
+ * Returns 0 on success, -1 on failure.
+ */
+
+int	replace_param(t_param *param, char *pattern, char *rep, char **out)
+{
+	t_pattern	pat;
+	t_buffer	buf;
+
+	if (!rep)
+		rep = "";
+	if (pattern_compile(&pat, pattern))
+		return (-1);
+	ft_bzero(&buf, sizeof(t_buffer));
+	if (replace_matches(&pat, param, rep, &buf))
+	{
+		pattern_free(&pat);
+		free(buf.data);
+		return (-1);
+	}
+	pattern_free(&pat);
+	*out = buffer_finish(&buf);
+	if (!*out)
+		return (-1);
+	return (0);
+}
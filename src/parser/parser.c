@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 18:47:33 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 18:47:33 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:59:23 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -44,30 +44,23 @@ static void	add_command(t_command **cmds, t_command *cmd)
 }
 
 /**
- * count_words - Counts the number of WORD tokens in the token list
- * @data: Pointer to the shell data structure
+ * fill_command_args - Copies the words of a command into its argv block
+ * @data: Pointer to the shell data structure, tokens at the command
+ * @args: The pointer table, with room for every word and two NULLs
+ * @dst: The bytes that follow the table, sized by count_words
  *
- * This function iterates through the tokens and counts how many WORD tokens
- * are present, excluding operators and special tokens.
- * Returns the count of WORD tokens.
+ * Every word is copied right after the previous one, so the argv and its
+ * strings form one allocation that goes to execve as is and is released
+ * with a single free().
+ * Returns 0 on success, 1 if a word has no value.
  */
 
-static int	handle_args(t_token *tokens, char **args)
-{
-	if (!is_cmd(tokens))
-		return (0);
-	else if (fill_words(tokens, args))
-		return (1);
-	return (0);
-}
-
-static int	fill_command_args(t_shell *data, char **args)
+static int	fill_command_args(t_shell *data, char **args, char *dst)
 {
 	t_token	*token;
+	size_t	len;
 	int		i;
-	char	*str;
 
-	str = NULL;
 	token = data->tokens;
 	i = 0;
 	while (token && token->type != PIPE && token->type != T_EOF)
@@ -75,10 +68,11 @@ static int	fill_command_args(t_shell *data, char **args)
 		if (token->type == WORD
 			&& (!token->previous || !is_token_operator(token->previous->type)))
 		{
-			if (handle_args(token, &str))
+			if (!token->value)
 				return (1);
-			if (str)
-				args[i++] = str;
+			len = ft_strlen(token->value) + 1;
+			args[i++] = ft_memcpy(dst, token->value, len);
+			dst += len;
 		}
 		token = token->next;
 	}
@@ -86,24 +80,64 @@ static int	fill_command_args(t_shell *data, char **args)
 	return (0);
 }
 
+/**
+ * split_assignments - Sets the NAME=value words in front of a command aside
+ * @data: Pointer to the shell data structure, tokens at the command
+ * @cmd: The command, whose block holds every word from its start
+ * @args_nb: Number of words
+ *
+ * Leading unquoted assignments become the command's overlay: the table
+ * is shifted by one slot past them to NULL-terminate them, and args
+ * starts after. A line made only of assignments keeps them as words.
+ */
+
+static void	split_assignments(t_shell *data, t_command *cmd, int args_nb)
+{
+	t_token	*token;
+	int		n;
+
+	token = data->tokens;
+	n = 0;
+	while (token && token->type != PIPE && token->type != T_EOF)
+	{
+		if (token->type == WORD
+			&& (!token->previous || !is_token_operator(token->previous->type)))
+		{
+			if (token->single_quote || token->double_quote
+				|| token->split_field || !is_assignment_word(token->value))
+				break ;
+			n++;
+		}
+		token = token->next;
+	}
+	if (n == args_nb)
+		n = 0;
+	while (args_nb-- >= n)
+		cmd->assigns[args_nb + 2] = cmd->assigns[args_nb + 1];
+	cmd->assigns[n] = NULL;
+	cmd->args = cmd->assigns + n + 1;
+}
+
 static int	create_command(t_shell *data, t_command **cmds)
 {
 	t_command	*cmd;
 	int			args_nb;
+	size_t		bytes;
 
 	cmd = malloc(sizeof(t_command));
 	if (!cmd)
 		return (1);
 	ft_memset(cmd, 0, sizeof(t_command));
-	args_nb = count_words(data);
+	args_nb = count_words(data, &bytes);
 	if (args_nb > 0)
 	{
-		cmd->args = malloc(sizeof(char *) * (args_nb + 1));
-		if (!cmd->args)
+		cmd->assigns = malloc(sizeof(char *) * (args_nb + 2) + bytes);
+		if (!cmd->assigns)
 			return (free_command(&cmd), 1);
-		ft_memset(cmd->args, 0, (sizeof(char *) * (args_nb + 1)));
-		if (fill_command_args(data, cmd->args))
+		if (fill_command_args(data, cmd->assigns,
+				(char *)(cmd->assigns + args_nb + 2)))
 			return (free_command(&cmd), 1);
+		split_assignments(data, cmd, args_nb);
 	}
 	cmd->redirs = init_redir(data);
 	if (!cmd->redirs && data->heredoc_interupt)
@@ -121,6 +155,7 @@ int	split_cmd_with_pipe(t_shell *data)
 
 	if (process_and_join_tokens(data))
 		return (1);
+	trace_phase(data, TRACE_SPLIT);
 	head = data->tokens;
 	token = data->tokens;
 	cmds = NULL;
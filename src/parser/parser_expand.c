@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/26 00:53:16 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 00:54:42 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 05:26:55 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -151,6 +151,7 @@ int	expand_token(t_shell *data)
 	t_token	*next_token;
 	int		result;
 
+	load_ifs(data);
 	token = data->tokens;
 	while (token && token->type != T_EOF)
 	{
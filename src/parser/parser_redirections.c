@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/14 20:38:44 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 00:14:58 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:02:33 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -119,7 +119,9 @@ char	*capture_heredoc(t_redir *redir, t_shell *data)
 	struct sigaction	old_int;
 	struct sigaction	old_quit;
 	t_char				strings;
+	t_trace_phase		phase;
 
+	phase = trace_phase(data, TRACE_HEREDOC);
 	strings.str = NULL;
 	data->heredoc_interupt = 0;
 	setup_heredoc_signal_handlers(&old_int, &old_quit);
@@ -129,5 +131,6 @@ char	*capture_heredoc(t_redir *redir, t_shell *data)
 	sigaction(SIGQUIT, &old_quit, NULL);
 	get_next_line(STDIN_FILENO, 1);
 	enable_control_char_echo();
+	trace_phase(data, phase);
 	return (str);
 }
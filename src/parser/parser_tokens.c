@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/14 20:39:44 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 00:29:35 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:02:33 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -101,6 +101,7 @@ static void	check_operator(t_token **tokens)
 
 int	syntax_check(t_shell *cmd)
 {
+	trace_phase(cmd, TRACE_SYNTAX);
 	cmd->heredoc_interupt = 0;
 	if (!cmd->tokens)
 		return (ft_putstr_fd(ERROR_TOKENIZE, 2), 1);
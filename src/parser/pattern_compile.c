@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pattern_compile.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:33:35 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:33:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * class_item - Adds one bracket expression item to a character set
+ * @p: The item, either a single character or a range such as "a-z"
+ * @set: The 256-bit character set
+ *
+ * Returns the number of pattern bytes used by the item.
+ */
+
+static int	class_item(const char *p, unsigned char *set)
+{
+	int	c;
+	int	last;
+	int	len;
+
+	c = (unsigned char)p[0];
+	last = c;
+	len = 1;
+	if (p[1] == '-' && p[2] && p[2] != ']')
+	{
+		last = (unsigned char)p[2];
+		len = 3;
+	}
+	while (c <= last)
+	{
+		set[c >> 3] |= 1 << (c & 7);
+		c++;
+	}
+	return (len);
+}
+
+/**
+ * parse_class - Compiles a bracket expression into a CLASS node
+ * @p: The pattern, starting at the opening '['
+ * @node: The node to fill
+ *
+ * A leading '!' or '^' negates the set and a ']' right after the opening
+ * bracket is taken literally. Negation is folded into the bitmap so that
+ * matching is a single bit test.
+ * Returns the number of pattern bytes used, or 0 if the bracket is not
+ * terminated and must be read as a plain '['.
+ */
+
+static int	parse_class(const char *p, t_pat_node *node)
+{
+	int	i;
+	int	j;
+	int	negate;
+
+	i = 1;
+	negate = (p[i] == '!' || p[i] == '^');
+	i += negate;
+	if (p[i] == ']')
+		i += class_item(p + i, node->set);
+	while (p[i] && p[i] != ']')
+		i += class_item(p + i, node->set);
+	if (!p[i])
+	{
+		ft_bzero(node->set, sizeof(node->set));
+		return (0);
+	}
+	node->op = PAT_CLASS;
+	j = 0;
+	while (negate && j < 32)
+	{
+		node->set[j] = ~node->set[j];
+		j++;
+	}
+	return (i + 1);
+}
+
+/**
+ * compile_nodes - Turns a pattern into a list of nodes
+ * @pat: The compiled pattern, its node array sized for the worst case
+ * @src: The pattern source
+ *
+ * Consecutive stars collapse into a single STAR node.
+ */
+
+static void	compile_nodes(t_pattern *pat, const char *src)
+{
+	t_pat_node	*node;
+	int			len;
+
+	while (*src)
+	{
+		node = &pat->nodes[pat->count];
+		ft_bzero(node, sizeof(t_pat_node));
+		len = 0;
+		if (*src == '[')
+			len = parse_class(src, node);
+		if (*src == '*')
+			node->op = PAT_STAR;
+		else if (*src == '?')
+			node->op = PAT_ANY;
+		else if (len == 0)
+			node->c = *src;
+		if (len == 0)
+			len = 1;
+		if (node->op != PAT_STAR || pat->count == 0
+			|| node[-1].op != PAT_STAR)
+			pat->count++;
+		src += len;
+	}
+}
+
+/**
+ * set_fast_path - Extracts the literal prefix and suffix of a pattern
+ * @pat: The compiled pattern
+ *
+ * The literal run before the first star and the one after the last star
+ * are copied into a flat buffer so they can be checked with a single
+ * memory compare before any node is walked.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	set_fast_path(t_pattern *pat)
+{
+	int	i;
+
+	i = -1;
+	while (++i < pat->count)
+	{
+		if (pat->nodes[i].op == PAT_STAR)
+			pat->has_star = 1;
+		else
+			pat->min_len++;
+	}
+	while (pat->prefix < pat->count
+		&& pat->nodes[pat->prefix].op == PAT_LITERAL)
+		pat->prefix++;
+	while (pat->has_star && pat->suffix < pat->count
+		&& pat->nodes[pat->count - 1 - pat->suffix].op == PAT_LITERAL)
+		pat->suffix++;
+	pat->literals = malloc(pat->prefix + pat->suffix + 1);
+	if (!pat->literals)
+		return (-1);
+	i = -1;
+	while (++i < pat->prefix + pat->suffix)
+		pat->literals[i] = pat->nodes[i + (i >= pat->prefix)
+			* (pat->count - pat->suffix - pat->prefix)].c;
+	return (0);
+}
+
+/**
+ * pattern_compile - Compiles a shell pattern into a matching program
+ * @pat: The compiled pattern to fill
+ * @src: The pattern, with '*', '?' and bracket expressions
+ *
+ * The pattern is parsed once, then matched any number of times with
+ * pattern_match. It must be released with pattern_free.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	pattern_compile(t_pattern *pat, const char *src)
+{
+	ft_bzero(pat, sizeof(t_pattern));
+	pat->nodes = malloc(sizeof(t_pat_node) * (ft_strlen(src) + 1));
+	if (!pat->nodes)
+		return (-1);
+	compile_nodes(pat, src);
+	if (set_fast_path(pat))
+	{
+		pattern_free(pat);
+		return (-1);
+	}
+	return (0);
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pattern_match.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:33:35 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:33:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * pattern_node_match - Matches a single character against a node
+ * @node: A LITERAL, ANY or CLASS node
+ * @c: The character to match
+ *
+ * Returns 1 if the character matches, 0 otherwise.
+ */
+
+int	pattern_node_match(t_pat_node *node, char c)
+{
+	unsigned char	uc;
+
+	uc = (unsigned char)c;
+	if (node->op == PAT_LITERAL)
+		return (node->c == uc);
+	if (node->op == PAT_ANY)
+		return (1);
+	return ((node->set[uc >> 3] >> (uc & 7)) & 1);
+}
+
+/**
+ * match_fixed - Matches a pattern without stars
+ * @pat: The compiled pattern
+ * @str: The string, already known to have the pattern length
+ *
+ * Every node consumes exactly one character, so node i faces str[i].
+ * Returns 1 if the string matches, 0 otherwise.
+ */
+
+static int	match_fixed(t_pattern *pat, const char *str)
+{
+	int	i;
+
+	i = pat->prefix;
+	while (i < pat->count)
+	{
+		if (!pattern_node_match(&pat->nodes[i], str[i]))
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * pattern_match - Matches a string against a compiled pattern
+ * @pat: The compiled pattern
+ * @str: The string to match
+ * @len: Length of the string
+ *
+ * Strings that are too short, or that do not start and end with the
+ * literal prefix and suffix, are rejected before any node is walked.
+ * Returns 1 if the whole string matches, 0 otherwise.
+ */
+
+int	pattern_match(t_pattern *pat, const char *str, int len)
+{
+	if (len < pat->min_len || (!pat->has_star && len != pat->min_len))
+		return (0);
+	if (ft_memcmp(str, pat->literals, pat->prefix))
+		return (0);
+	if (!pat->has_star)
+		return (match_fixed(pat, str));
+	if (ft_memcmp(str + len - pat->suffix, pat->literals + pat->prefix,
+			pat->suffix))
+		return (0);
+	return (match_middle(pat, str + pat->prefix,
+			len - pat->prefix - pat->suffix));
+}
+
+/**
+ * pattern_free - Releases a compiled pattern
+ * @pat: The compiled pattern
+ */
+
+void	pattern_free(t_pattern *pat)
+{
+	free(pat->nodes);
+	free(pat->literals);
+	pat->nodes = NULL;
+	pat->literals = NULL;
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pattern_star.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:33:35 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:33:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * star_skip - Finds where the node following a star can start matching
+ * @m: The matching state
+ * @node: The node right after the star
+ * @from: First position to try
+ *
+ * When the star is followed by a literal, the candidate positions are
+ * found with memchr instead of trying every single character.
+ * Returns the position, or -1 if the literal never appears.
+ */
+
+static int	star_skip(t_match *m, t_pat_node *node, int from)
+{
+	const char	*hit;
+
+	if (node->op != PAT_LITERAL || from >= m->len)
+		return (from);
+	hit = ft_memchr(m->str + from, node->c, m->len - from);
+	if (!hit)
+		return (-1);
+	return (hit - m->str);
+}
+
+/**
+ * enter_star - Records a star as the current backtracking point
+ * @pat: The compiled pattern
+ * @m: The matching state
+ *
+ * Returns 1 if the star ends the pattern and matches the rest of the
+ * string, 0 if the match is impossible, -1 to keep matching.
+ */
+
+static int	enter_star(t_pattern *pat, t_match *m)
+{
+	m->pi++;
+	if (m->pi == m->end)
+		return (1);
+	m->si = star_skip(m, &pat->nodes[m->pi], m->si);
+	if (m->si < 0)
+		return (0);
+	m->star_pi = m->pi;
+	m->star_si = m->si;
+	return (-1);
+}
+
+/**
+ * backtrack - Lets the last star absorb one more character
+ * @pat: The compiled pattern
+ * @m: The matching state
+ *
+ * Only the last star is ever retried, which keeps matching linear in
+ * practice instead of exploring every star combination.
+ * Returns 0 if the match is impossible, -1 to keep matching.
+ */
+
+static int	backtrack(t_pattern *pat, t_match *m)
+{
+	if (m->star_pi < 0)
+		return (0);
+	m->pi = m->star_pi;
+	m->si = star_skip(m, &pat->nodes[m->pi], m->star_si + 1);
+	if (m->si < 0)
+		return (0);
+	m->star_si = m->si;
+	return (-1);
+}
+
+/**
+ * start_match - Sets up the state used to match the middle of a pattern
+ * @m: The matching state
+ * @pat: The compiled pattern
+ * @str: The string, without the part matched by the prefix and suffix
+ * @len: Length of that part
+ */
+
+static void	start_match(t_match *m, t_pattern *pat, const char *str, int len)
+{
+	m->str = str;
+	m->len = len;
+	m->pi = pat->prefix;
+	m->si = 0;
+	m->star_pi = -1;
+	m->star_si = 0;
+	m->end = pat->count - pat->suffix;
+}
+
+/**
+ * match_middle - Matches the part of a pattern between its literal ends
+ * @pat: The compiled pattern
+ * @str: The string, without the part matched by the prefix and suffix
+ * @len: Length of that part
+ *
+ * Returns 1 if the string matches, 0 otherwise.
+ */
+
+int	match_middle(t_pattern *pat, const char *str, int len)
+{
+	t_match	m;
+	int		ret;
+
+	start_match(&m, pat, str, len);
+	while (m.si < m.len)
+	{
+		if (m.pi < m.end && pat->nodes[m.pi].op == PAT_STAR)
+			ret = enter_star(pat, &m);
+		else if (m.pi < m.end && pattern_node_match(&pat->nodes[m.pi],
+				m.str[m.si]))
+		{
+			m.pi++;
+			m.si++;
+			continue ;
+		}
+		else
+			ret = backtrack(pat, &m);
+		if (ret >= 0)
+			return (ret);
+	}
+	while (m.pi < m.end && pat->nodes[m.pi].op == PAT_STAR)
+		m.pi++;
+	return (m.pi == m.end);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_prefix.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:57:26 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:57:26 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * skip_blanks - Steps over blanks in a command line
+ * @input: The command line
+ * @i: Index to start from
+ *
+ * Returns the index of the first non-blank character.
+ */
+
+static int	skip_blanks(char *input, int i)
+{
+	while (input[i] && is_whitespace(input[i]))
+		i++;
+	return (i);
+}
+
+/**
+ * take_option - Consumes one option of the time keyword
+ * @input: The command line, modified in place
+ * @i: Index of the option
+ * @format: Set to the output format the option selects
+ *
+ * -p selects the POSIX output, -j one JSON object per command.
+ * Returns the index after the option, or i if there is no option there.
+ */
+
+static int	take_option(char *input, int i, int *format)
+{
+	if (input[i] != '-' || (input[i + 1] != 'p' && input[i + 1] != 'j')
+		|| (input[i + 2] && !is_whitespace(input[i + 2])))
+		return (i);
+	if (input[i + 1] == 'p')
+		*format = TIME_POSIX;
+	else
+		*format = TIME_JSON;
+	input[i] = ' ';
+	input[i + 1] = ' ';
+	return (i + 2);
+}
+
+/**
+ * take_time - Detects and removes a leading time keyword from a line
+ * @shell: Shell context, receiving the timing state
+ * @input: The command line, modified in place
+ *
+ * As in bash, time is a keyword in front of a whole pipeline rather
+ * than a builtin. Timing state left by a line that failed to parse is
+ * dropped first.
+ * Returns 1 for a timed line, 0 otherwise, -1 on allocation failure.
+ */
+
+int	take_time(t_shell *shell, char *input)
+{
+	int	i;
+	int	next;
+	int	format;
+
+	free_timing(shell);
+	i = skip_blanks(input, 0);
+	if (ft_strncmp(input + i, "time", 4) != 0
+		|| (input[i + 4] && !is_whitespace(input[i + 4])))
+		return (0);
+	ft_memset(input + i, ' ', 4);
+	format = TIME_DEFAULT;
+	next = skip_blanks(input, i + 4);
+	i = -1;
+	while (next != i)
+	{
+		i = next;
+		next = skip_blanks(input, take_option(input, i, &format));
+	}
+	shell->timing = malloc(sizeof(t_timing));
+	if (!shell->timing)
+		return (-1);
+	ft_memset(shell->timing, 0, sizeof(t_timing));
+	shell->timing->format = format;
+	return (1);
+}
@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/11 02:30:53 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 00:26:14 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 05:47:56 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -46,6 +46,7 @@ static int	handle_operator(char *input, int *i, t_token **tokens)
  *
  * This function creates a token 
  * for the content inside quotes and adds it to the token list.
+ * Inside double quotes, expansion groups are stepped over whole.
  * It also handles any errors related to quotes.
  * Returns the updated index after processing the quoted content.
  */
@@ -59,7 +60,12 @@ static int	handle_quote(char *input, int *i, t_token **tokens)
 	quote = input[(*i)];
 	start_quote = ++(*i);
 	while (input[(*i)] && input[(*i)] != quote)
-		(*i)++;
+	{
+		if (quote == '"')
+			(*i) = skip_word_char(input, *i);
+		else
+			(*i)++;
+	}
 	if (input[(*i)] == '\0')
 	{
 		token = create_token(ERROR, ERROR_QUOTES);
@@ -93,7 +99,7 @@ static int	handle_word(char *input, int *i, t_token **tokens)
 	start_word = (*i);
 	while (input[(*i)] && !is_whitespace(input[(*i)])
 		&& is_operator(input, *i) == -1 && !is_quote(input[(*i)]))
-		(*i)++;
+		(*i) = skip_word_char(input, *i);
 	token = create_token(WORD, NULL);
 	if (!token)
 		return (-1);
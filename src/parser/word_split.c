@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   word_split.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:25:20 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:25:20 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * load_ifs - Precomputes the field separator bitmaps from IFS
+ * @data: The shell data structure holding the environment
+ *
+ * Builds a 256-bit delimiter map and a second map for the IFS whitespace
+ * characters (space, tab, newline), so every later lookup is a single
+ * bit test. An unset IFS behaves like " \t\n", an empty one disables
+ * field splitting. Called once per command line before expansion.
+ */
+
+void	load_ifs(t_shell *data)
+{
+	char			*ifs;
+	unsigned char	c;
+	int				i;
+
+	ft_memset(&data->ifs, 0, sizeof(t_ifs));
+	ifs = get_env_value(data, "IFS");
+	if (!ifs)
+		ifs = " \t\n";
+	i = 0;
+	while (ifs[i])
+	{
+		c = (unsigned char)ifs[i++];
+		data->ifs.delim[c >> 3] |= (1 << (c & 7));
+		if (c == ' ' || c == '\t' || c == '\n')
+			data->ifs.space[c >> 3] |= (1 << (c & 7));
+	}
+}
+
+/**
+ * ifs_bit - Tests a character against one of the IFS bitmaps
+ * @map: Either the delimiter or the whitespace bitmap
+ * @c: The character to test
+ *
+ * Returns 1 if the character is set in the map, 0 otherwise.
+ */
+
+int	ifs_bit(const unsigned char *map, char c)
+{
+	return ((map[(unsigned char)c >> 3] >> ((unsigned char)c & 7)) & 1);
+}
+
+/**
+ * skip_ifs_space - Skips a run of IFS whitespace
+ * @ifs: The precomputed IFS bitmaps
+ * @str: The expanded string being split
+ * @i: Index to start from
+ *
+ * Returns the index of the first character that is not IFS whitespace.
+ */
+
+int	skip_ifs_space(t_ifs *ifs, char *str, int i)
+{
+	while (str[i] && ifs_bit(ifs->space, str[i]))
+		i++;
+	return (i);
+}
+
+/**
+ * skip_ifs_delimiters - Consumes exactly one field separator
+ * @ifs: The precomputed IFS bitmaps
+ * @str: The expanded string being split
+ * @i: Index of the delimiter that ended the previous field
+ *
+ * A separator is either a run of IFS whitespace, or a single non-whitespace
+ * IFS character together with any IFS whitespace around it. Two adjacent
+ * non-whitespace delimiters therefore leave an empty field between them.
+ * Returns the index where the next field starts.
+ */
+
+int	skip_ifs_delimiters(t_ifs *ifs, char *str, int i)
+{
+	i = skip_ifs_space(ifs, str, i);
+	if (str[i] && ifs_bit(ifs->delim, str[i]) && !ifs_bit(ifs->space, str[i]))
+		i = skip_ifs_space(ifs, str, i + 1);
+	return (i);
+}
+
+/**
+ * ifs_field_end - Finds the end of the field starting at i
+ * @ifs: The precomputed IFS bitmaps
+ * @str: The expanded string being split
+ * @i: Index where the field starts
+ *
+ * Returns the index of the next delimiter or of the terminating null byte.
+ */
+
+int	ifs_field_end(t_ifs *ifs, char *str, int i)
+{
+	while (str[i] && !ifs_bit(ifs->delim, str[i]))
+		i++;
+	return (i);
+}
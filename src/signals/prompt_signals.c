@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prompt_signals.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:08:13 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:08:13 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * Handles SIGINT (Ctrl+C) during main shell operation
+ * 
+ * @param sig  Signal number (unused but required by signal API)
+ * 
+ * Handles interrupt differently based on shell state:
+ * - During command execution (status 999): Sets status and prints newline
+ * - During command input: Resets line, displays prompt on new line
+ */
+void	handle_prompt_interrupt(int sig)
+{
+	int	executing;
+
+	executing = (g_exit_status == 999);
+	handle_interrupt(sig);
+	if (executing)
+		return ;
+	rl_on_new_line();
+	rl_replace_line("", 0);
+	rl_redisplay();
+}
+
+/**
+ * Sets up signal handlers for main shell operation
+ * 
+ * Configures custom interrupt handler and ignores quit and suspend signals.
+ * This provides a more user-friendly shell experience similar to bash.
+ */
+
+void	setup_signals(void)
+{
+	struct sigaction	sa_int;
+	struct sigaction	sa_quit;
+	struct sigaction	sa_tstp;
+
+	sa_int.sa_handler = handle_prompt_interrupt;
+	sigemptyset(&sa_int.sa_mask);
+	sa_int.sa_flags = SA_RESTART;
+	sigaction(SIGINT, &sa_int, NULL);
+	sa_quit.sa_handler = SIG_IGN;
+	sigemptyset(&sa_quit.sa_mask);
+	sa_quit.sa_flags = 0;
+	sigaction(SIGQUIT, &sa_quit, NULL);
+	sa_tstp.sa_handler = SIG_IGN;
+	sigemptyset(&sa_tstp.sa_mask);
+	sa_tstp.sa_flags = 0;
+	sigaction(SIGTSTP, &sa_tstp, NULL);
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   buffer.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:38:48 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:58:42 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * buffer_reserve - Makes room for more bytes in a growable buffer
+ * @buf: The buffer
+ * @extra: Number of bytes about to be appended
+ *
+ * The capacity doubles when it runs out, so appending n bytes in any
+ * number of pieces costs O(n) overall.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	buffer_reserve(t_buffer *buf, size_t extra)
+{
+	char	*grown;
+	size_t	cap;
+
+	if (buf->len + extra + 1 <= buf->cap)
+		return (0);
+	cap = buf->cap * 2;
+	if (cap < buf->len + extra + 1)
+		cap = buf->len + extra + 1;
+	if (cap < 64)
+		cap = 64;
+	grown = malloc(cap);
+	if (!grown)
+		return (-1);
+	if (buf->data)
+		ft_memcpy(grown, buf->data, buf->len);
+	grown[buf->len] = '\0';
+	free(buf->data);
+	buf->data = grown;
+	buf->cap = cap;
+	return (0);
+}
+
+/**
+ * buffer_append - Appends bytes to a growable buffer
+ * @buf: The buffer, kept NUL-terminated
+ * @src: The bytes to append
+ * @len: Number of bytes to append
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	buffer_append(t_buffer *buf, const char *src, size_t len)
+{
+	if (buffer_reserve(buf, len))
+		return (-1);
+	ft_memcpy(buf->data + buf->len, src, len);
+	buf->len += len;
+	buf->data[buf->len] = '\0';
+	return (0);
+}
+
+/**
+ * buffer_finish - Hands the content of a buffer over to the caller
+ * @buf: The buffer
+ *
+ * Returns the NUL-terminated content, an empty string for an empty
+ * buffer, or NULL on allocation failure.
+ */
+
+char	*buffer_finish(t_buffer *buf)
+{
+	char	*str;
+
+	if (!buf->data)
+		return (ft_strdup(""));
+	str = buf->data;
+	buf->data = NULL;
+	buf->len = 0;
+	buf->cap = 0;
+	return (str);
+}
+
+/**
+ * buffer_append_num - Appends a decimal number to a growable buffer
+ * @buf: The buffer
+ * @n: The number, non-negative
+ * @width: Minimum number of digits, padded with leading zeros
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	buffer_append_num(t_buffer *buf, long n, int width)
+{
+	char	digits[24];
+	int		i;
+
+	if (n < 0)
+		n = 0;
+	i = 24;
+	while (i > 0 && (n || 24 - i < width || i == 24))
+	{
+		digits[--i] = '0' + n % 10;
+		n /= 10;
+	}
+	return (buffer_append(buf, digits + i, 24 - i));
+}
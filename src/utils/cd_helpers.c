@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/03 22:02:16 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/07/04 00:54:06 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:57:28 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -82,30 +82,16 @@ char	*create_full_path(char *oldpwd, char *target)
 }
 
 /**
- * Checks if the target is a symlink
- * If the target is relative, it checks against OLDPWD.
- * If absolute, it checks directly.
- * Returns 1 if symlink, 0 otherwise.
+ * Handles special case for // paths
  */
-int	check_symlink(char *path, char *oldpwd, char *target)
+int	handle_double_slash(t_shell *shell, char *oldpwd, char *target)
 {
-	struct stat		path_stat;
-	char			*full_path;
-	int				is_symlink;
-
-	is_symlink = 0;
-	(void)path;
-	if (target[0] != '/' && oldpwd)
+	if (target && ft_strcmp(target, "//") == 0)
 	{
-		full_path = create_full_path(oldpwd, target);
-		if (full_path)
-		{
-			if (lstat(full_path, &path_stat) == 0)
-				is_symlink = S_ISLNK(path_stat.st_mode);
-			free(full_path);
-		}
+		if (oldpwd)
+			update_env(shell, "OLDPWD", oldpwd);
+		update_env(shell, "PWD", "//");
+		return (1);
 	}
-	else if (lstat(target, &path_stat) == 0)
-		is_symlink = S_ISLNK(path_stat.st_mode);
-	return (is_symlink);
+	return (0);
 }
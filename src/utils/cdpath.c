@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cdpath.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:54:16 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:18:05 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * probe_prefix - Tells whether a CDPATH prefix holds the target
+ * @shell: Shell context holding the lookup cache
+ * @dir: The prefix directory
+ * @path: The prefix joined with the target
+ * @name: The target as given to cd
+ *
+ * The verdict for a prefix/target pair, found or not, is kept together
+ * with the prefix's mtime; entries are only added to or removed from a
+ * directory by changing it, so while the mtime holds the verdict does
+ * too. The mtime is checked once per command line, later lookups on the
+ * same line take the verdict as is. That only covers targets that are a
+ * single entry of the prefix: deeper ones change below it, and relative
+ * prefixes follow the current directory, so neither is cached.
+ * Returns 1 if the target is a directory under the prefix, 0 otherwise.
+ */
+
+static int	probe_prefix(t_shell *shell, char *dir, char *path, char *name)
+{
+	t_cdpath_cache	*entry;
+	struct stat		st;
+
+	entry = NULL;
+	if (dir[0] == '/' && !ft_strchr(name, '/'))
+		entry = cdpath_verdict(shell, dir, name);
+	if (entry && entry->checked == shell->lines_read)
+		return (entry->found);
+	if (stat(dir, &st) == -1)
+		return (0);
+	if (!entry)
+		return (stat(path, &st) == 0 && S_ISDIR(st.st_mode));
+	entry->checked = shell->lines_read;
+	if (entry->mtime.tv_sec == st.st_mtim.tv_sec
+		&& entry->mtime.tv_nsec == st.st_mtim.tv_nsec)
+		return (entry->found);
+	entry->mtime = st.st_mtim;
+	entry->found = (stat(path, &st) == 0 && S_ISDIR(st.st_mode));
+	return (entry->found);
+}
+
+/**
+ * try_prefix - Looks for the target under the next CDPATH prefix
+ * @shell: Shell context holding the lookup cache
+ * @cdpath: The rest of CDPATH, starting at the prefix
+ * @name: The target as given to cd
+ * @path: Set to the directory to enter, or NULL
+ *
+ * A hit under an empty prefix, the current directory, stops the search
+ * but leaves @path NULL: cd then enters the target as given and does
+ * not print it.
+ * Returns 1 if the search is over, 0 to go on with the next prefix.
+ */
+
+static int	try_prefix(t_shell *shell, char *cdpath, char *name, char **path)
+{
+	char	*prefix;
+	char	*dir;
+	int		found;
+
+	*path = NULL;
+	if (ft_strchr(cdpath, ':'))
+		prefix = ft_substr(cdpath, 0, ft_strchr(cdpath, ':') - cdpath);
+	else
+		prefix = ft_strdup(cdpath);
+	if (!prefix)
+		return (1);
+	dir = prefix;
+	if (!*prefix)
+		dir = ".";
+	*path = create_full_path(dir, name);
+	found = (*path && probe_prefix(shell, dir, *path, name));
+	if (!found || !*prefix)
+	{
+		free(*path);
+		*path = NULL;
+	}
+	free(prefix);
+	return (found);
+}
+
+/**
+ * cdpath_search - Resolves a cd argument through CDPATH
+ * @shell: Shell context
+ * @arg: The argument given to cd, or NULL
+ * @cdpath: The part of CDPATH left to search, moved past the prefix
+ * that held the directory, so that a directory that cannot be entered
+ * lets the search go on
+ *
+ * Like bash, arguments that are absolute or start with . or .. are
+ * never searched.
+ * Returns the directory to enter, allocated, or NULL when cd should use
+ * its argument as is.
+ */
+
+char	*cdpath_search(t_shell *shell, char *arg, char **cdpath)
+{
+	char	*path;
+	int		found;
+
+	if (!arg || !*arg || arg[0] == '/' || !ft_strcmp(arg, "-")
+		|| (arg[0] == '.' && (!arg[1] || arg[1] == '/'
+				|| (arg[1] == '.' && (!arg[2] || arg[2] == '/')))))
+		return (NULL);
+	while (*cdpath)
+	{
+		found = try_prefix(shell, *cdpath, arg, &path);
+		*cdpath = ft_strchr(*cdpath, ':');
+		if (*cdpath)
+			(*cdpath)++;
+		if (found && !path)
+			*cdpath = NULL;
+		if (found)
+			return (path);
+	}
+	return (NULL);
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cdpath_cache.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:18:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:18:05 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cdpath.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:54:16 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:57:28 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+static void	free_verdict(t_cdpath_cache *entry)
+{
+	free(entry->prefix);
+	free(entry->name);
+	free(entry);
+}
+
+/**
+ * new_verdict - Allocates the cache entry of a prefix/target pair
+ * @dir: The prefix directory
+ * @name: The target as given to cd
+ *
+ * A new entry was never checked, so it never passes for a valid one.
+ * Returns the entry, or NULL on allocation failure.
+ */
+
+static t_cdpath_cache	*new_verdict(char *dir, char *name)
+{
+	t_cdpath_cache	*entry;
+
+	entry = ft_calloc(1, sizeof(t_cdpath_cache));
+	if (!entry)
+		return (NULL);
+	entry->checked = -1;
+	entry->prefix = ft_strdup(dir);
+	entry->name = ft_strdup(name);
+	if (!entry->prefix || !entry->name)
+	{
+		free_verdict(entry);
+		return (NULL);
+	}
+	return (entry);
+}
+
+/**
+ * drop_oldest - Makes room for a new entry in a full cache
+ * @shell: Shell context holding the lookup cache
+ *
+ * The list is kept in order of use, so its last entry is the one unused
+ * the longest.
+ */
+
+static void	drop_oldest(t_shell *shell)
+{
+	t_cdpath_cache	**link;
+	int				count;
+
+	count = 1;
+	link = &shell->cdpath_cache;
+	while (*link && (*link)->next)
+	{
+		count++;
+		link = &(*link)->next;
+	}
+	if (*link && count >= CDPATH_CACHE_MAX)
+	{
+		free_verdict(*link);
+		*link = NULL;
+	}
+}
+
+/**
+ * cdpath_verdict - Finds or adds the cache entry of a prefix/target pair
+ * @shell: Shell context holding the lookup cache
+ * @dir: The prefix directory
+ * @name: The target as given to cd
+ *
+ * The entry found moves to the front of the list; a new one takes the
+ * place of the oldest once CDPATH_CACHE_MAX entries are held.
+ * Returns the entry, or NULL on allocation failure.
+ */
+
+t_cdpath_cache	*cdpath_verdict(t_shell *shell, char *dir, char *name)
+{
+	t_cdpath_cache	**link;
+	t_cdpath_cache	*entry;
+
+	link = &shell->cdpath_cache;
+	while (*link && (ft_strcmp((*link)->prefix, dir)
+			|| ft_strcmp((*link)->name, name)))
+		link = &(*link)->next;
+	entry = *link;
+	if (entry)
+		*link = entry->next;
+	else
+	{
+		drop_oldest(shell);
+		entry = new_verdict(dir, name);
+	}
+	if (!entry)
+		return (NULL);
+	entry->next = shell->cdpath_cache;
+	shell->cdpath_cache = entry;
+	return (entry);
+}
+
+/**
+ * free_cdpath_cache - Drops every cached CDPATH verdict
+ * @shell: Shell context
+ */
+
+void	free_cdpath_cache(t_shell *shell)
+{
+	t_cdpath_cache	*next;
+
+	while (shell->cdpath_cache)
+	{
+		next = shell->cdpath_cache->next;
+		free_verdict(shell->cdpath_cache);
+		shell->cdpath_cache = next;
+	}
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dir_cache.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:30:13 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:30:13 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * grow_listing - Grows the entry arrays of a cached directory listing
+ * @dir: The cached listing
+ * @capacity: Pointer to the current capacity, updated on success
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	grow_listing(t_dir_cache *dir, int *capacity)
+{
+	char			**names;
+	unsigned char	*types;
+	int				size;
+
+	size = *capacity * 2 + 32;
+	names = malloc(sizeof(char *) * size);
+	types = malloc(size);
+	if (!names || !types)
+		return (free(names), free(types), -1);
+	if (dir->count)
+	{
+		ft_memcpy(names, dir->names, sizeof(char *) * dir->count);
+		ft_memcpy(types, dir->types, dir->count);
+	}
+	free(dir->names);
+	free(dir->types);
+	dir->names = names;
+	dir->types = types;
+	*capacity = size;
+	return (0);
+}
+
+/**
+ * read_listing - Reads every entry of a directory into the cache
+ * @dir: The cached listing to fill
+ * @stream: The open directory
+ *
+ * The '.' and '..' entries are never stored, patterns cannot match them.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	read_listing(t_dir_cache *dir, DIR *stream)
+{
+	struct dirent	*entry;
+	int				capacity;
+
+	capacity = 0;
+	entry = readdir(stream);
+	while (entry)
+	{
+		if (ft_strcmp(entry->d_name, ".") && ft_strcmp(entry->d_name, ".."))
+		{
+			if (dir->count == capacity && grow_listing(dir, &capacity))
+				return (-1);
+			dir->names[dir->count] = ft_strdup(entry->d_name);
+			if (!dir->names[dir->count])
+				return (-1);
+			dir->types[dir->count++] = entry->d_type;
+		}
+		entry = readdir(stream);
+	}
+	return (0);
+}
+
+/**
+ * free_listing - Frees a cached directory listing
+ * @dir: The cached listing
+ */
+
+static void	free_listing(t_dir_cache *dir)
+{
+	while (dir->count > 0)
+		free(dir->names[--dir->count]);
+	free(dir->names);
+	free(dir->types);
+	free(dir->path);
+	free(dir);
+}
+
+/**
+ * get_dir_listing - Returns the entries of a directory
+ * @shell: Pointer to the shell structure holding the cache
+ * @path: The directory, empty for the current one
+ *
+ * Each directory is read once per command line. A directory that cannot
+ * be opened is cached as an empty listing.
+ * Returns the cached listing, or NULL on allocation failure.
+ */
+
+t_dir_cache	*get_dir_listing(t_shell *shell, char *path)
+{
+	t_dir_cache	*dir;
+	DIR			*stream;
+
+	dir = shell->dir_cache;
+	while (dir && ft_strcmp(dir->path, path))
+		dir = dir->next;
+	if (dir)
+		return (dir);
+	dir = ft_calloc(1, sizeof(t_dir_cache));
+	if (!dir)
+		return (NULL);
+	dir->path = ft_strdup(path);
+	if (!dir->path)
+		return (free(dir), NULL);
+	if (path[0])
+		stream = opendir(path);
+	else
+		stream = opendir(".");
+	if (stream && read_listing(dir, stream))
+		return (closedir(stream), free_listing(dir), NULL);
+	if (stream)
+		closedir(stream);
+	dir->next = shell->dir_cache;
+	shell->dir_cache = dir;
+	return (dir);
+}
+
+/**
+ * free_dir_cache - Drops every cached directory listing
+ * @shell: Pointer to the shell structure holding the cache
+ */
+
+void	free_dir_cache(t_shell *shell)
+{
+	t_dir_cache	*next;
+
+	while (shell->dir_cache)
+	{
+		next = shell->dir_cache->next;
+		free_listing(shell->dir_cache);
+		shell->dir_cache = next;
+	}
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dir_stack.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:47:31 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:47:31 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * dir_entry_here - Records the current directory for the stack
+ * @shell: Shell context, whose PWD names the directory
+ *
+ * The directory is kept as an O_PATH descriptor together with its
+ * device and inode, and named by PWD, or by getcwd() when PWD is unset.
+ * Returns the new entry, or NULL on failure.
+ */
+
+t_dir_stack	*dir_entry_here(t_shell *shell)
+{
+	t_dir_stack	*entry;
+	struct stat	st;
+
+	entry = ft_calloc(1, sizeof(t_dir_stack));
+	if (!entry)
+		return (NULL);
+	entry->fd = open(".", O_PATH | O_DIRECTORY | O_CLOEXEC);
+	if ((entry->fd != -1 && fstat(entry->fd, &st) == 0)
+		|| (entry->fd == -1 && stat(".", &st) == 0))
+	{
+		entry->dev = st.st_dev;
+		entry->ino = st.st_ino;
+		if (get_env_value(shell, "PWD"))
+			entry->path = ft_strdup(get_env_value(shell, "PWD"));
+		else
+			entry->path = getcwd(NULL, 0);
+	}
+	if (!entry->path)
+	{
+		error("pushd", NULL, strerror(errno));
+		free_dir_entry(entry);
+		return (NULL);
+	}
+	return (entry);
+}
+
+/**
+ * entry_is_valid - Checks that an entry's descriptor is still its own
+ * @entry: The stack entry
+ * @live: Non-zero to also require that the directory was not removed
+ *
+ * A single fstatat() on the descriptor must find the device and inode
+ * recorded when the entry was pushed, so a descriptor closed and reused
+ * behind our back is never followed nor closed.
+ * Returns 1 if the descriptor is valid, 0 otherwise.
+ */
+
+static int	entry_is_valid(t_dir_stack *entry, int live)
+{
+	struct stat	st;
+
+	if (entry->fd < 0 || fstatat(entry->fd, "", &st, AT_EMPTY_PATH) == -1)
+		return (0);
+	return (st.st_dev == entry->dev && st.st_ino == entry->ino
+		&& (!live || st.st_nlink > 0));
+}
+
+/**
+ * dir_entry_enter - Makes a stacked directory the current one
+ * @shell: Shell context whose PWD and OLDPWD are updated
+ * @entry: The stack entry
+ * @name: Builtin name for error messages
+ *
+ * The directory is entered with fchdir() on its descriptor, or chdir()
+ * on its path when the descriptor is gone or its directory was removed.
+ * The path cached in the entry becomes PWD, so nothing is resolved
+ * again.
+ * Returns 0 on success, 1 on failure.
+ */
+
+int	dir_entry_enter(t_shell *shell, t_dir_stack *entry, char *name)
+{
+	char	*oldpwd;
+
+	if (!(entry_is_valid(entry, 1) && fchdir(entry->fd) == 0)
+		&& chdir(entry->path) == -1)
+	{
+		error(name, entry->path, strerror(errno));
+		return (1);
+	}
+	oldpwd = get_env_value(shell, "PWD");
+	if (oldpwd)
+		update_env(shell, "OLDPWD", oldpwd);
+	update_env(shell, "PWD", entry->path);
+	return (0);
+}
+
+/**
+ * free_dir_entry - Releases a stack entry
+ * @entry: The entry, or NULL
+ *
+ * The descriptor is only closed while it still refers to the entry's
+ * directory; once closed by a descriptor sweep its number may belong
+ * to something else.
+ */
+
+void	free_dir_entry(t_dir_stack *entry)
+{
+	if (!entry)
+		return ;
+	if (entry_is_valid(entry, 0))
+		close(entry->fd);
+	free(entry->path);
+	free(entry);
+}
+
+/**
+ * free_dir_stack - Releases the whole directory stack
+ * @shell: Shell context
+ */
+
+void	free_dir_stack(t_shell *shell)
+{
+	t_dir_stack	*next;
+
+	while (shell->dir_stack)
+	{
+		next = shell->dir_stack->next;
+		free_dir_entry(shell->dir_stack);
+		shell->dir_stack = next;
+	}
+}
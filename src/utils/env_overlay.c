@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_overlay.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:59:23 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:59:23 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * is_assignment_word - Tells whether a word is a NAME=value assignment
+ * @word: The word
+ *
+ * Returns 1 if the word starts with a valid identifier followed by '=',
+ * 0 otherwise.
+ */
+
+int	is_assignment_word(const char *word)
+{
+	int	i;
+
+	if (!word || !(ft_isalpha(word[0]) || word[0] == '_'))
+		return (0);
+	i = 1;
+	while (ft_isalnum(word[i]) || word[i] == '_')
+		i++;
+	return (word[i] == '=');
+}
+
+/**
+ * overlay_value - Looks a variable up in a command's prefix assignments
+ * @overlay: The NULL-terminated assignments, or NULL
+ * @name: The variable name, not necessarily terminated after @len
+ * @len: Length of the name
+ *
+ * As in bash, the last assignment to a name wins.
+ * Returns the value, or NULL if the name is not assigned.
+ */
+
+char	*overlay_value(char **overlay, const char *name, size_t len)
+{
+	char	*value;
+	int		i;
+
+	value = NULL;
+	i = 0;
+	while (overlay && overlay[i])
+	{
+		if (ft_strncmp(overlay[i], name, len) == 0 && overlay[i][len] == '=')
+			value = overlay[i] + len + 1;
+		i++;
+	}
+	return (value);
+}
+
+/**
+ * name_length - Returns the length of the name in a NAME=value string
+ * @var: The variable, with or without a value
+ */
+
+static size_t	name_length(const char *var)
+{
+	char	*equal;
+
+	equal = ft_strchr(var, '=');
+	if (!equal)
+		return (ft_strlen(var));
+	return (equal - var);
+}
+
+/**
+ * copy_visible - Copies the variables an overlay does not hide
+ * @dst: The environment being built
+ * @src: The variables to copy
+ * @overlay: The assignments that hide variables of the same name
+ * @self: Non-zero when @src is the overlay, each entry then being hidden
+ *        by the later ones
+ *
+ * Only the pointers are copied, the strings stay where they are.
+ * Returns the number of variables copied.
+ */
+
+static int	copy_visible(char **dst, char **src, char **overlay, int self)
+{
+	int	i;
+	int	n;
+
+	i = 0;
+	n = 0;
+	while (src && src[i])
+	{
+		if (self)
+			overlay = src + i + 1;
+		if (!overlay_value(overlay, src[i], name_length(src[i])))
+			dst[n++] = src[i];
+		i++;
+	}
+	return (n);
+}
+
+/**
+ * exec_environment - Builds the envp of a command with prefix assignments
+ * @shell: Shell context, whose env_overlay holds the assignments
+ *
+ * The shell's environment is neither copied nor changed: the result is
+ * a fresh table of pointers to its strings, where a variable assigned in
+ * front of the command is replaced by its last assignment. It is meant
+ * for execve() and the env builtin.
+ * Returns the table, or shell->env itself when there is nothing to
+ * overlay or no memory for the table.
+ */
+
+char	**exec_environment(t_shell *shell)
+{
+	char	**env;
+	int		size;
+	int		n;
+
+	if (!shell->env_overlay || !shell->env_overlay[0])
+		return (shell->env);
+	size = 0;
+	while (shell->env && shell->env[size])
+		size++;
+	n = 0;
+	while (shell->env_overlay[n])
+		n++;
+	env = malloc(sizeof(char *) * (size + n + 1));
+	if (!env)
+		return (shell->env);
+	size = copy_visible(env, shell->env, shell->env_overlay, 0);
+	size += copy_visible(env + size, shell->env_overlay, NULL, 1);
+	env[size] = NULL;
+	return (env);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:17:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * init_history - Loads the saved history into readline
+ * @shell: The shell
+ *
+ * Readline's list mirrors the lines of the ring, so the rank of a line
+ * among them is also its position in readline's history. Ctrl-R
+ * searches the ring through its trigram index.
+ */
+
+void	init_history(t_shell *shell)
+{
+	t_history	*h;
+	int			slot;
+	int			i;
+
+	h = &shell->history;
+	history_load(shell);
+	i = 0;
+	while (i < h->count)
+	{
+		slot = (h->start + i++) % h->size;
+		if (h->lines[slot])
+			add_history(h->lines[slot]);
+	}
+	install_history_search(h);
+}
+
+/**
+ * record_history - Adds a command line to the history
+ * @shell: The shell
+ * @line: The line
+ *
+ * A line repeating the previous one is not recorded again; an older
+ * copy of it, or the oldest line when the history is full, is removed
+ * from readline's list as it is from the ring. Recorded lines are
+ * appended to the history log.
+ */
+
+void	record_history(t_shell *shell, char *line)
+{
+	uint32_t	hash;
+	int			removed;
+
+	hash = history_hash(line, ft_strlen(line));
+	removed = history_push(&shell->history, line, hash);
+	if (removed == -2)
+		return ;
+	if (removed >= 0)
+		free_history_entry(remove_history(removed));
+	add_history(line);
+	history_log_append(&shell->history, line, hash);
+}
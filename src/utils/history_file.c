@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_file.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:17:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * history_hash - Hashes a history line (FNV-1a)
+ * @line: The line, not necessarily NUL-terminated
+ * @len: Its length
+ *
+ * Returns the 32-bit hash of the line.
+ */
+
+uint32_t	history_hash(const char *line, size_t len)
+{
+	uint32_t	hash;
+	size_t		i;
+
+	hash = 2166136261u;
+	i = 0;
+	while (i < len)
+	{
+		hash ^= (unsigned char)line[i++];
+		hash *= 16777619u;
+	}
+	return (hash);
+}
+
+/**
+ * write_record - Writes one history record to the log
+ * @fd: The log, opened for appending
+ * @line: The line
+ * @hash: Its hash
+ *
+ * The header and the line go out in a single writev() on an O_APPEND
+ * descriptor, so records from several shells never interleave.
+ * Returns 0 on success, -1 on failure.
+ */
+
+static int	write_record(int fd, const char *line, uint32_t hash)
+{
+	t_hist_rec		rec;
+	struct iovec	iov[2];
+	ssize_t			total;
+
+	rec.len = ft_strlen(line);
+	rec.hash = hash;
+	iov[0].iov_base = &rec;
+	iov[0].iov_len = sizeof(rec);
+	iov[1].iov_base = (void *)line;
+	iov[1].iov_len = rec.len;
+	total = sizeof(rec) + rec.len;
+	if (writev(fd, iov, 2) != total)
+		return (-1);
+	return (0);
+}
+
+/**
+ * history_open_log - Opens the history log, creating it if needed
+ * @h: The history, with the path of the log
+ *
+ * A new log starts with the magic string; an existing one must begin
+ * with it, so that no other file is ever read or appended to.
+ * Returns the descriptor, or -1 if the log cannot be used.
+ */
+
+int	history_open_log(t_history *h)
+{
+	struct stat	st;
+	char		magic[HIST_MAGIC_LEN];
+	int			fd;
+
+	fd = open(h->path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+	if (fd == -1)
+		return (-1);
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode))
+		return (close(fd), -1);
+	if (st.st_size == 0
+		&& write(fd, HIST_MAGIC, HIST_MAGIC_LEN) == HIST_MAGIC_LEN)
+		return (fd);
+	if (st.st_size >= HIST_MAGIC_LEN
+		&& pread(fd, magic, HIST_MAGIC_LEN, 0) == HIST_MAGIC_LEN
+		&& ft_memcmp(magic, HIST_MAGIC, HIST_MAGIC_LEN) == 0)
+		return (fd);
+	close(fd);
+	return (-1);
+}
+
+/**
+ * history_log_append - Appends a line to the history log
+ * @h: The history
+ * @line: The line
+ * @hash: Its hash
+ *
+ * The log is opened for each line rather than kept open, since a failed
+ * redirection closes every descriptor the shell holds. Once it holds
+ * twice as many records as the history keeps, it is compacted.
+ */
+
+void	history_log_append(t_history *h, const char *line, uint32_t hash)
+{
+	int	fd;
+
+	if (!h->path)
+		return ;
+	fd = open(h->path, O_WRONLY | O_APPEND | O_CLOEXEC);
+	if (fd == -1)
+		return ;
+	if (write_record(fd, line, hash) == 0)
+		h->logged++;
+	close(fd);
+	if (h->logged > 2 * (long)h->cap)
+		history_trim_log(h);
+}
+
+/**
+ * history_compact - Rewrites the history log with the ring only
+ * @h: The history
+ *
+ * The new log is written beside the old one and renamed over it, so
+ * the log is never seen half written.
+ */
+
+void	history_compact(t_history *h)
+{
+	char	*tmp;
+	int		fd;
+	int		slot;
+	int		i;
+
+	tmp = ft_strjoin(h->path, ".tmp");
+	if (!tmp)
+		return ;
+	fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+	i = -1;
+	if (fd != -1 && write(fd, HIST_MAGIC, HIST_MAGIC_LEN) == HIST_MAGIC_LEN)
+		i = 0;
+	while (i >= 0 && i < h->count)
+	{
+		slot = (h->start + i++) % h->size;
+		if (h->lines[slot]
+			&& write_record(fd, h->lines[slot], h->hashes[slot]))
+			i = -1;
+	}
+	if (fd != -1 && close(fd) == 0 && i >= 0)
+		rename(tmp, h->path);
+	else if (fd != -1)
+		unlink(tmp);
+	free(tmp);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_index.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:28:19 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:28:19 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * key_slot - Finds the slot of a trigram in the index table
+ * @x: The index, with a table
+ * @key: The trigram, its three bytes packed
+ *
+ * Returns the slot holding the trigram, or the empty slot where it
+ * belongs.
+ */
+
+static size_t	key_slot(t_hist_index *x, uint32_t key)
+{
+	size_t	slot;
+
+	slot = (key * 2654435761u) & x->mask;
+	while (x->slots[slot].key && x->slots[slot].key != key)
+		slot = (slot + 1) & x->mask;
+	return (slot);
+}
+
+/**
+ * index_grow - Doubles the table of the history index
+ * @x: The index
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	index_grow(t_hist_index *x)
+{
+	t_tri_list	*old;
+	t_tri_list	*grown;
+	size_t		old_size;
+	size_t		i;
+
+	old = x->slots;
+	old_size = 0;
+	if (old)
+		old_size = x->mask + 1;
+	i = 1024;
+	if (old_size * 2 > i)
+		i = old_size * 2;
+	grown = ft_calloc(i, sizeof(t_tri_list));
+	if (!grown)
+		return (-1);
+	x->slots = grown;
+	x->mask = i - 1;
+	i = old_size;
+	while (i-- > 0)
+	{
+		if (old[i].key)
+			x->slots[key_slot(x, old[i].key)] = old[i];
+	}
+	free(old);
+	return (0);
+}
+
+/**
+ * hist_index_slot - Finds the posting list of a trigram
+ * @x: The index
+ * @p: The trigram, three non-NUL bytes
+ * @claim: Whether to make a list for a trigram not indexed yet
+ *
+ * Returns the list, one with a zero key if the trigram is not indexed
+ * and @claim is 0, or NULL if the index is empty.
+ */
+
+t_tri_list	*hist_index_slot(t_hist_index *x, const char *p, int claim)
+{
+	uint32_t	key;
+	size_t		slot;
+
+	if (!x->slots)
+		return (NULL);
+	key = (uint32_t)(unsigned char)p[0] << 16
+		| (uint32_t)(unsigned char)p[1] << 8 | (unsigned char)p[2];
+	slot = key_slot(x, key);
+	if (claim && !x->slots[slot].key)
+	{
+		x->slots[slot].key = key;
+		x->used++;
+	}
+	return (&x->slots[slot]);
+}
+
+/**
+ * hist_index_add - Indexes the trigrams of a history line
+ * @x: The index
+ * @line: The line
+ * @id: Its id, greater than any id indexed before
+ *
+ * Each posting list is thus kept sorted, oldest line first, and holds
+ * a line once however often the trigram appears in it.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	hist_index_add(t_hist_index *x, const char *line, uint32_t id)
+{
+	t_tri_list	*list;
+	uint32_t	last;
+
+	while (line[0] && line[1] && line[2])
+	{
+		if ((!x->slots || x->used * 2 >= x->mask) && index_grow(x))
+			return (-1);
+		list = hist_index_slot(x, line, 1);
+		last = 0;
+		if (list->ids.len)
+			ft_memcpy(&last, list->ids.data + list->ids.len - sizeof(last),
+				sizeof(last));
+		if (last != id
+			&& buffer_append(&list->ids, (char *)&id, sizeof(id)))
+			return (-1);
+		line++;
+	}
+	return (0);
+}
+
+/**
+ * hist_index_free - Frees the history index
+ * @x: The index
+ */
+
+void	hist_index_free(t_hist_index *x)
+{
+	size_t	i;
+
+	i = 0;
+	while (x->slots && i <= x->mask)
+		free(x->slots[i++].ids.data);
+	free(x->slots);
+	ft_memset(x, 0, sizeof(*x));
+}
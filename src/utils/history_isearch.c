@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_isearch.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:28:19 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:57:41 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * search_history - Remembers the history for readline's Ctrl-R binding
+ * @h: The history to remember, or NULL to only query it
+ *
+ * Returns the remembered history.
+ */
+
+static t_history	*search_history(t_history *h)
+{
+	static t_history	*saved;
+
+	if (h)
+		saved = h;
+	return (saved);
+}
+
+/**
+ * show_search - Displays the state of a reverse search
+ * @s: The search
+ * @h: The history
+ *
+ * The line found is put in the line buffer, the cursor on the match,
+ * and the query shown in place of the prompt. A failed search leaves
+ * the last match and the cursor where they were.
+ */
+
+static void	show_search(t_isearch *s, t_history *h)
+{
+	char	*line;
+
+	line = history_entry(h, s->found);
+	if (line && !s->failed)
+	{
+		rl_replace_line(line, 0);
+		rl_point = ft_strstr(line, s->query) - line;
+	}
+	if (s->failed)
+		rl_message("(failed reverse-i-search)`%s': ", s->query);
+	else
+		rl_message("(reverse-i-search)`%s': ", s->query);
+	rl_redisplay();
+}
+
+/**
+ * search_key - Applies a key to a reverse search
+ * @s: The search
+ * @h: The history
+ * @c: The key
+ *
+ * A printable key extends the query, which may still match the line
+ * found; Ctrl-R looks for an older match; a backspace shortens the
+ * query and searches again from the newest line.
+ * Returns 1 if the search goes on, 0 if the key ends it.
+ */
+
+static int	search_key(t_isearch *s, t_history *h, int c)
+{
+	uint32_t	before;
+	uint32_t	id;
+
+	before = UINT32_MAX;
+	if (c == CTRL('R') && s->found)
+		before = s->found;
+	else if ((c == RUBOUT || c == CTRL('H')) && s->len > 0)
+		s->query[--s->len] = '\0';
+	else if (c >= ' ' && c != RUBOUT
+		&& s->len < (int) sizeof(s->query) - 1)
+	{
+		s->query[s->len++] = c;
+		s->query[s->len] = '\0';
+		if (s->found && !s->failed)
+			before = s->found + 1;
+	}
+	else if (c != CTRL('R'))
+		return (0);
+	id = history_lookup(h, s->query, before);
+	s->failed = (id == 0);
+	if (id)
+		s->found = id;
+	return (1);
+}
+
+/**
+ * reverse_search - Searches the history backwards as keys are typed
+ * @count: Unused
+ * @key: Unused
+ *
+ * Replaces readline's own incremental search, which walks the whole
+ * history, with lookups in the trigram index. Ctrl-G gives the line
+ * back as it was; any other key that ends the search keeps the line
+ * found and is then handled as usual, so Enter runs it.
+ * Returns 0.
+ */
+
+static int	reverse_search(int count, int key)
+{
+	t_isearch	s;
+	char		*saved;
+	int			c;
+
+	(void)count;
+	(void)key;
+	saved = ft_strdup(rl_line_buffer);
+	ft_memset(&s, 0, sizeof(s));
+	show_search(&s, search_history(NULL));
+	c = rl_read_key();
+	while (c > 0 && c != CTRL('G') && search_key(&s, search_history(NULL), c))
+	{
+		show_search(&s, search_history(NULL));
+		c = rl_read_key();
+	}
+	if (c == CTRL('G') && saved)
+	{
+		rl_replace_line(saved, 0);
+		rl_point = rl_end;
+	}
+	rl_clear_message();
+	if (c > 0 && c != CTRL('G'))
+		rl_execute_next(c);
+	free(saved);
+	return (0);
+}
+
+/**
+ * install_history_search - Binds Ctrl-R to the indexed history search
+ * @h: The history
+ */
+
+void	install_history_search(t_history *h)
+{
+	search_history(h);
+	rl_bind_key(CTRL('R'), reverse_search);
+}
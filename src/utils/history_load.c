@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_load.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:17:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * history_capacity - Reads the size of the history from HISTSIZE
+ * @shell: The shell, with its environment
+ *
+ * An unset or malformed HISTSIZE gives the default size, and a huge one
+ * is capped.
+ * Returns the number of lines the history holds.
+ */
+
+static int	history_capacity(t_shell *shell)
+{
+	char	*value;
+	long	size;
+	int		i;
+
+	value = get_env_value(shell, "HISTSIZE");
+	if (!value || !*value)
+		return (HIST_DEFAULT_SIZE);
+	size = 0;
+	i = 0;
+	while (ft_isdigit(value[i]) && size <= HIST_MAX_SIZE)
+		size = size * 10 + value[i++] - '0';
+	if (value[i] && !ft_isdigit(value[i]))
+		return (HIST_DEFAULT_SIZE);
+	if (size > HIST_MAX_SIZE)
+		return (HIST_MAX_SIZE);
+	return (size);
+}
+
+/**
+ * map_log - Replays the history log into the ring
+ * @h: The history, empty
+ * @fd: The log
+ * @size: Its size
+ *
+ * The log is mapped and only the record headers are read, so no line is
+ * parsed. A record cut short by a crash is dropped from the log, and a
+ * log holding more than twice the lines kept is rewritten; the number
+ * of records left is kept to compact it again during the session.
+ */
+
+static void	map_log(t_history *h, int fd, size_t size)
+{
+	char	*data;
+	size_t	end;
+	int		records;
+
+	if (size <= HIST_MAGIC_LEN)
+		return ;
+	data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+		return ;
+	records = history_replay(h, data, size, &end);
+	munmap(data, size);
+	if (records >= 0 && end < size)
+		ftruncate(fd, end);
+	h->logged = records;
+	if (records <= 2 * h->cap)
+		return ;
+	history_compact(h);
+	h->logged = h->live;
+}
+
+/**
+ * open_ring - Allocates the history ring
+ * @h: The history
+ * @cap: Number of lines it holds
+ *
+ * The ring has twice as many slots as lines, so that removed lines can
+ * leave their slot empty, the hash table twice as many entries as the
+ * ring has slots, and the tree one count per slot.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	open_ring(t_history *h, int cap)
+{
+	size_t	entries;
+
+	entries = 2;
+	while (entries < 4 * (size_t)cap)
+		entries *= 2;
+	h->lines = malloc(sizeof(char *) * 2 * cap);
+	h->hashes = malloc(sizeof(uint32_t) * 2 * cap);
+	h->ids = malloc(sizeof(uint32_t) * 2 * cap);
+	h->table = ft_calloc(entries, sizeof(int));
+	h->tree = ft_calloc(2 * cap + 1, sizeof(int));
+	if (!h->lines || !h->hashes || !h->ids || !h->table || !h->tree)
+	{
+		free_history(h);
+		return (-1);
+	}
+	h->cap = cap;
+	h->size = 2 * cap;
+	h->mask = entries - 1;
+	h->start = 0;
+	h->count = 0;
+	h->live = 0;
+	return (0);
+}
+
+/**
+ * history_trim_log - Compacts the history log during a session
+ * @h: The history
+ *
+ * Called once twice as many records as the history keeps were written
+ * since the log was last compacted. The log is replayed into a ring of
+ * its own rather than rewritten from @h, so that the lines other shells
+ * appended in the meantime are kept.
+ */
+
+void	history_trim_log(t_history *h)
+{
+	t_history	log;
+	struct stat	st;
+	int			fd;
+
+	ft_memset(&log, 0, sizeof(log));
+	h->logged = 0;
+	if (open_ring(&log, h->cap))
+		return ;
+	log.path = h->path;
+	fd = history_open_log(&log);
+	if (fd != -1 && fstat(fd, &st) == 0)
+		map_log(&log, fd, st.st_size);
+	if (fd != -1)
+		close(fd);
+	h->logged = log.logged;
+	log.path = NULL;
+	free_history(&log);
+}
+
+/**
+ * history_load - Sets up the history and loads it from the log
+ * @shell: The shell
+ *
+ * The history holds HISTSIZE lines and is kept in ~/.minishell_history,
+ * a log of length-prefixed records. Without a home directory, or with a
+ * file that is not a history log, the history lives in memory only.
+ */
+
+void	history_load(t_shell *shell)
+{
+	t_history	*h;
+	struct stat	st;
+	char		*home;
+	int			fd;
+
+	h = &shell->history;
+	if (open_ring(h, history_capacity(shell)) || h->cap == 0)
+		return ;
+	home = get_env_value(shell, "HOME");
+	if (!home || !*home)
+		return ;
+	h->path = ft_strjoin(home, HIST_FILE);
+	if (!h->path)
+		return ;
+	fd = history_open_log(h);
+	if (fd == -1 || fstat(fd, &st) == -1)
+	{
+		free(h->path);
+		h->path = NULL;
+	}
+	else
+		map_log(h, fd, st.st_size);
+	if (fd != -1)
+		close(fd);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_rank.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:38:13 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_ring.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:17:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:28:19 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * tree_sum - Counts the lines held in the first slots of the ring
+ * @h: The history
+ * @slot: Number of slots counted, from the first one
+ *
+ * The tree is a Fenwick tree over the slots, holding 1 for each slot
+ * with a line.
+ * Returns the number of lines in slots 0 to @slot - 1.
+ */
+
+static int	tree_sum(t_history *h, int slot)
+{
+	int	n;
+
+	n = 0;
+	while (slot > 0)
+	{
+		n += h->tree[slot - 1];
+		slot -= slot & -slot;
+	}
+	return (n);
+}
+
+/**
+ * history_tree_mark - Records that a slot gained or lost its line
+ * @h: The history
+ * @slot: The slot
+ * @delta: 1 when a line was put in the slot, -1 when it was removed
+ */
+
+void	history_tree_mark(t_history *h, int slot, int delta)
+{
+	slot++;
+	while (slot <= h->size)
+	{
+		h->tree[slot - 1] += delta;
+		slot += slot & -slot;
+	}
+}
+
+/**
+ * history_tree_build - Builds the tree from the slots of the ring
+ * @h: The history
+ *
+ * Each node passes its count on to its parent, so the whole tree is
+ * built in a single pass over the slots.
+ */
+
+void	history_tree_build(t_history *h)
+{
+	int	i;
+	int	parent;
+
+	i = 0;
+	while (i < h->size)
+	{
+		h->tree[i] = (h->lines[i] != NULL);
+		i++;
+	}
+	i = 1;
+	while (i <= h->size)
+	{
+		parent = i + (i & -i);
+		if (parent <= h->size)
+			h->tree[parent - 1] += h->tree[i - 1];
+		i++;
+	}
+}
+
+/**
+ * history_rank - Tells how many lines of the history are older than one
+ * @h: The history
+ * @slot: The slot of the line, holding it
+ *
+ * Readline's list holds the lines only, so this is the position of the
+ * line in it. The ring may wrap around, hence the count modulo the
+ * number of lines.
+ * Returns the rank of the line, 0 for the oldest.
+ */
+
+int	history_rank(t_history *h, int slot)
+{
+	return ((tree_sum(h, slot) - tree_sum(h, h->start) + h->live) % h->live);
+}
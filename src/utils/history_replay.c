@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_replay.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:17:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:17:05 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * next_record - Reads the header of a history record
+ * @data: The mapped log
+ * @size: Its size
+ * @off: Offset of the record
+ * @rec: Where to store the header
+ *
+ * Returns 1 if a whole record starts at @off, 0 at the end of the log
+ * or at a record cut short.
+ */
+
+static int	next_record(const char *data, size_t size, size_t off,
+	t_hist_rec *rec)
+{
+	if (off > size || size - off < sizeof(*rec))
+		return (0);
+	ft_memcpy(rec, data + off, sizeof(*rec));
+	if (rec->len == 0 || rec->len > size - off - sizeof(*rec))
+		return (0);
+	return (1);
+}
+
+/**
+ * walk_records - Finds the records of the history log
+ * @data: The mapped log
+ * @size: Its size
+ * @offs: Where to store the offset of each record, or NULL
+ * @end: Where to store the offset following the last whole record
+ *
+ * Only the headers are read: the length of each record leads straight
+ * to the next one.
+ * Returns the number of records.
+ */
+
+static int	walk_records(const char *data, size_t size, size_t *offs,
+	size_t *end)
+{
+	t_hist_rec	rec;
+	size_t		off;
+	int			n;
+
+	off = HIST_MAGIC_LEN;
+	n = 0;
+	while (n < INT_MAX && next_record(data, size, off, &rec))
+	{
+		if (offs)
+			offs[n] = off;
+		off += sizeof(rec) + rec.len;
+		n++;
+	}
+	*end = off;
+	return (n);
+}
+
+/**
+ * seen_before - Checks whether a newer record holds the same line
+ * @r: The replay state, with the set of the records kept so far
+ * @idx: Index of the record
+ *
+ * The set is an open-addressing table of record indexes plus one,
+ * probed by the hash stored in the record header.
+ * Returns 1 if the line was already kept, 0 after adding it.
+ */
+
+static int	seen_before(t_hist_replay *r, int idx)
+{
+	t_hist_rec	rec;
+	t_hist_rec	other;
+	size_t		slot;
+	const char	*line;
+
+	ft_memcpy(&rec, r->data + r->offs[idx], sizeof(rec));
+	line = r->data + r->offs[idx] + sizeof(rec);
+	slot = rec.hash & r->mask;
+	while (r->set[slot])
+	{
+		ft_memcpy(&other, r->data + r->offs[r->set[slot] - 1], sizeof(other));
+		if (other.hash == rec.hash && other.len == rec.len
+			&& ft_memcmp(line, r->data + r->offs[r->set[slot] - 1]
+				+ sizeof(other), rec.len) == 0)
+			return (1);
+		slot = (slot + 1) & r->mask;
+	}
+	r->set[slot] = idx + 1;
+	return (0);
+}
+
+/**
+ * keep_newest - Fills the ring with the newest distinct lines
+ * @h: The history, empty
+ * @r: The replay state
+ * @n: Number of records in the log
+ * @kept: Room for the index of min(@n, capacity) records
+ *
+ * The log is walked from its end, so that the last use of a line is
+ * the one kept, then the lines are added oldest first.
+ */
+
+static void	keep_newest(t_history *h, t_hist_replay *r, int n, int *kept)
+{
+	t_hist_rec	rec;
+	int			count;
+
+	count = 0;
+	while (n-- > 0 && count < h->cap)
+	{
+		if (!seen_before(r, n))
+			kept[count++] = n;
+	}
+	while (count-- > 0)
+	{
+		ft_memcpy(&rec, r->data + r->offs[kept[count]], sizeof(rec));
+		if (history_append(h, r->data + r->offs[kept[count]] + sizeof(rec),
+				rec.len, rec.hash))
+			break ;
+	}
+}
+
+/**
+ * history_replay - Loads the history ring from the mapped log
+ * @h: The history, empty
+ * @data: The mapped log, starting with the magic string
+ * @size: Its size
+ * @end: Where to store the offset following the last whole record
+ *
+ * Returns the number of records in the log, or -1 on allocation
+ * failure.
+ */
+
+int	history_replay(t_history *h, const char *data, size_t size,
+	size_t *end)
+{
+	t_hist_replay	r;
+	int				*kept;
+	size_t			slots;
+	int				n;
+
+	n = walk_records(data, size, NULL, end);
+	slots = 2;
+	while (slots < 2 * (size_t)n && slots < 4 * (size_t)h->cap)
+		slots *= 2;
+	r.data = data;
+	r.mask = slots - 1;
+	r.offs = malloc(sizeof(size_t) * (n + 1));
+	r.set = ft_calloc(slots, sizeof(int));
+	kept = malloc(sizeof(int) * (n + 1));
+	if (r.offs && r.set && kept)
+	{
+		walk_records(data, size, r.offs, end);
+		keep_newest(h, &r, n, kept);
+	}
+	else
+		n = -1;
+	free(r.offs);
+	free(r.set);
+	free(kept);
+	return (n);
+}
@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_ring.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:17:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * history_find - Looks for a line already in the history
+ * @h: The history
+ * @line: The line, not necessarily NUL-terminated
+ * @len: Its length
+ * @hash: Its hash
+ *
+ * Only the slots whose hash lands on the same probe sequence of the
+ * table are visited, and the lines themselves are only compared when
+ * their hashes are equal.
+ * Returns the slot of the line, or -1.
+ */
+
+static int	history_find(t_history *h, const char *line, size_t len,
+	uint32_t hash)
+{
+	size_t	i;
+	int		slot;
+
+	i = hash & h->mask;
+	while (h->table[i])
+	{
+		slot = h->table[i] - 1;
+		if (h->hashes[slot] == hash && ft_strlen(h->lines[slot]) == len
+			&& ft_memcmp(h->lines[slot], line, len) == 0)
+			return (slot);
+		i = (i + 1) & h->mask;
+	}
+	return (-1);
+}
+
+/**
+ * history_remove - Removes a line from the history
+ * @h: The history
+ * @slot: The slot of the line
+ *
+ * The slot is only cleared, the lines around it stay where they are;
+ * cleared slots at the start of the ring are given back at once, the
+ * others when the ring is squeezed. Its id stays in the index until
+ * the index is rebuilt.
+ */
+
+static void	history_remove(t_history *h, int slot)
+{
+	history_table_drop(h, slot);
+	history_tree_mark(h, slot, -1);
+	free(h->lines[slot]);
+	h->lines[slot] = NULL;
+	h->live--;
+	h->index.dead++;
+	while (h->count > 0 && !h->lines[h->start])
+	{
+		h->start = (h->start + 1) % h->size;
+		h->count--;
+	}
+}
+
+/**
+ * history_append - Adds a line as the newest of the history
+ * @h: The history, not full
+ * @line: The line, not necessarily NUL-terminated
+ * @len: Its length
+ * @hash: Its hash
+ *
+ * The line gets an id above all others, and its trigrams are indexed
+ * once the index is in use; if the index cannot grow, it is dropped
+ * until the next search.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	history_append(t_history *h, const char *line, size_t len,
+	uint32_t hash)
+{
+	char	*copy;
+	int		slot;
+
+	copy = malloc(len + 1);
+	if (!copy)
+		return (-1);
+	ft_memcpy(copy, line, len);
+	copy[len] = '\0';
+	if (h->count == h->size)
+		history_squeeze(h);
+	slot = (h->start + h->count) % h->size;
+	h->lines[slot] = copy;
+	h->hashes[slot] = hash;
+	h->ids[slot] = ++h->next_id;
+	h->count++;
+	h->live++;
+	history_table_add(h, slot);
+	history_tree_mark(h, slot, 1);
+	if (h->index.live && hist_index_add(&h->index, copy, h->ids[slot]))
+		hist_index_free(&h->index);
+	return (0);
+}
+
+/**
+ * history_push - Records a line in the history ring
+ * @h: The history
+ * @line: The line
+ * @hash: Its hash, from history_hash()
+ *
+ * A line equal to the newest one is ignored. A line found further back
+ * is moved to the newest place, and when the ring is full the oldest
+ * line makes room, so the history never holds a line twice nor more
+ * than its capacity. The index is rebuilt once it holds more removed
+ * lines than the ring can hold.
+ * Returns -2 if the line was not added, -1 if it was added without
+ * removing anything, otherwise the rank of the line removed.
+ */
+
+int	history_push(t_history *h, const char *line, uint32_t hash)
+{
+	size_t	len;
+	int		slot;
+	int		rank;
+
+	if (h->cap <= 0)
+		return (-2);
+	len = ft_strlen(line);
+	slot = history_find(h, line, len, hash);
+	if (slot >= 0 && h->ids[slot] == h->next_id)
+		return (-2);
+	if (slot < 0 && h->live == h->cap)
+		slot = h->start;
+	rank = -1;
+	if (slot >= 0)
+	{
+		rank = history_rank(h, slot);
+		history_remove(h, slot);
+	}
+	if (history_append(h, line, len, hash))
+		return (-2);
+	if (h->index.live && h->index.dead > (size_t)h->cap)
+		hist_index_rebuild(h);
+	return (rank);
+}
+
+/**
+ * free_history - Frees the history ring
+ * @h: The history
+ */
+
+void	free_history(t_history *h)
+{
+	while (h->count-- > 0)
+	{
+		free(h->lines[h->start]);
+		h->start = (h->start + 1) % h->size;
+	}
+	free(h->lines);
+	free(h->hashes);
+	free(h->ids);
+	free(h->table);
+	free(h->tree);
+	free(h->path);
+	hist_index_free(&h->index);
+	h->lines = NULL;
+	h->hashes = NULL;
+	h->ids = NULL;
+	h->table = NULL;
+	h->tree = NULL;
+	h->path = NULL;
+	h->count = 0;
+	h->live = 0;
+	h->cap = 0;
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_search.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:28:19 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * history_entry - Finds a history line by its id
+ * @h: The history
+ * @id: The id
+ *
+ * Ids grow from the oldest line to the newest, cleared slots keeping
+ * the id of their line, so the ring is searched by bisection.
+ * Returns the line, or NULL if it is no longer in the history.
+ */
+
+char	*history_entry(t_history *h, uint32_t id)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+	int	slot;
+
+	lo = 0;
+	hi = h->count;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		slot = (h->start + mid) % h->size;
+		if (h->ids[slot] == id)
+			return (h->lines[slot]);
+		if (h->ids[slot] < id)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (NULL);
+}
+
+/**
+ * rarest_list - Picks the shortest posting list of a query's trigrams
+ * @h: The history
+ * @query: The query, at least three bytes long
+ *
+ * Every line holding the query is in each of these lists, so the
+ * shortest one is enough to find them all.
+ * Returns the list, or NULL if some trigram is in no line.
+ */
+
+static t_tri_list	*rarest_list(t_history *h, const char *query)
+{
+	t_tri_list	*best;
+	t_tri_list	*list;
+
+	best = NULL;
+	while (query[0] && query[1] && query[2])
+	{
+		list = hist_index_slot(&h->index, query, 0);
+		if (!list || !list->key)
+			return (NULL);
+		if (!best || list->ids.len < best->ids.len)
+			best = list;
+		query++;
+	}
+	return (best);
+}
+
+/**
+ * count_below - Counts the ids of a posting list below a bound
+ * @ids: The ids, sorted
+ * @n: Their number
+ * @before: The bound
+ *
+ * Returns the number of ids lower than @before.
+ */
+
+static size_t	count_below(const uint32_t *ids, size_t n, uint32_t before)
+{
+	size_t	lo;
+	size_t	mid;
+
+	lo = 0;
+	while (lo < n)
+	{
+		mid = lo + (n - lo) / 2;
+		if (ids[mid] < before)
+			lo = mid + 1;
+		else
+			n = mid;
+	}
+	return (lo);
+}
+
+/**
+ * scan_history - Searches the history line by line
+ * @h: The history
+ * @query: The query
+ * @before: Only lines with a lower id are searched
+ *
+ * Used for queries too short to have a trigram, or when the index
+ * cannot be built.
+ * Returns the id of the newest matching line, or 0.
+ */
+
+static uint32_t	scan_history(t_history *h, const char *query,
+	uint32_t before)
+{
+	int	i;
+	int	slot;
+
+	i = h->count;
+	while (i-- > 0)
+	{
+		slot = (h->start + i) % h->size;
+		if (h->lines[slot] && h->ids[slot] < before
+			&& ft_strstr(h->lines[slot], query))
+			return (h->ids[slot]);
+	}
+	return (0);
+}
+
+/**
+ * history_lookup - Finds the newest history line holding a string
+ * @h: The history
+ * @query: The string
+ * @before: Only lines with a lower id are searched, to find older
+ * matches one after the other
+ *
+ * Only the lines in the shortest posting list of the query's trigrams
+ * are checked, newest first; ids of lines removed since are skipped.
+ * The index is built on the first search.
+ * Returns the id of the line, or 0 if none matches.
+ */
+
+uint32_t	history_lookup(t_history *h, const char *query, uint32_t before)
+{
+	t_tri_list		*list;
+	const uint32_t	*ids;
+	size_t			i;
+	char			*line;
+
+	if (!h->index.live && h->live > 0)
+		hist_index_rebuild(h);
+	if (!h->index.live || ft_strlen(query) < 3)
+		return (scan_history(h, query, before));
+	list = rarest_list(h, query);
+	if (!list)
+		return (0);
+	ids = (const uint32_t *)list->ids.data;
+	i = count_below(ids, list->ids.len / sizeof(uint32_t), before);
+	while (i-- > 0)
+	{
+		line = history_entry(h, ids[i]);
+		if (line && ft_strstr(line, query))
+			return (ids[i]);
+	}
+	return (0);
+}
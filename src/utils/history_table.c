@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_table.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:34:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:46:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_ring.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:17:05 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:28:19 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * history_table_add - Makes a ring slot findable by the hash of its line
+ * @h: The history
+ * @slot: The slot, holding a line
+ *
+ * The table maps hashes to slots plus one, 0 marking a free entry, with
+ * linear probing. It has at least twice as many entries as the ring has
+ * slots, so it never fills up.
+ */
+
+void	history_table_add(t_history *h, int slot)
+{
+	size_t	i;
+
+	i = h->hashes[slot] & h->mask;
+	while (h->table[i])
+		i = (i + 1) & h->mask;
+	h->table[i] = slot + 1;
+}
+
+/**
+ * history_table_drop - Removes a ring slot from the hash table
+ * @h: The history
+ * @slot: The slot, in the table
+ *
+ * The entries probed past the freed one are moved back into it when
+ * their own hash allows, so that no removal leaves a marker behind and
+ * lookups stay as short as if the slot had never been added.
+ */
+
+void	history_table_drop(t_history *h, int slot)
+{
+	size_t	i;
+	size_t	j;
+	size_t	home;
+
+	i = h->hashes[slot] & h->mask;
+	while (h->table[i] != slot + 1)
+		i = (i + 1) & h->mask;
+	j = (i + 1) & h->mask;
+	while (h->table[j])
+	{
+		home = h->hashes[h->table[j] - 1] & h->mask;
+		if (((j - home) & h->mask) >= ((j - i) & h->mask))
+		{
+			h->table[i] = h->table[j];
+			i = j;
+		}
+		j = (j + 1) & h->mask;
+	}
+	h->table[i] = 0;
+}
+
+/**
+ * history_squeeze - Moves the lines of the ring over the removed ones
+ * @h: The history, its ring used up to the last slot
+ *
+ * Removing a line only clears its slot, so the ring has twice as many
+ * slots as lines kept; once they are all used, at least half of them
+ * are free again after this pass, which keeps its cost constant per
+ * line added. The order of the lines, and their ids, are kept; the
+ * hash table and the tree of held slots are rebuilt.
+ */
+
+void	history_squeeze(t_history *h)
+{
+	int	from;
+	int	to;
+	int	i;
+
+	to = h->start;
+	i = 0;
+	while (i < h->count)
+	{
+		from = (h->start + i++) % h->size;
+		if (!h->lines[from])
+			continue ;
+		h->lines[to] = h->lines[from];
+		h->hashes[to] = h->hashes[from];
+		h->ids[to] = h->ids[from];
+		if (to != from)
+			h->lines[from] = NULL;
+		to = (to + 1) % h->size;
+	}
+	h->count = h->live;
+	ft_memset(h->table, 0, sizeof(int) * (h->mask + 1));
+	i = 0;
+	while (i < h->count)
+		history_table_add(h, (h->start + i++) % h->size);
+	history_tree_build(h);
+}
+
+/**
+ * hist_index_rebuild - Rebuilds the history index from the ring
+ * @h: The history
+ *
+ * The index is only built for the first search, so that loading a long
+ * history costs nothing more, and rebuilt to drop the ids of the lines
+ * removed from the ring, which only make the posting lists longer.
+ */
+
+void	hist_index_rebuild(t_history *h)
+{
+	int	i;
+	int	slot;
+
+	hist_index_free(&h->index);
+	i = 0;
+	while (i < h->count)
+	{
+		slot = (h->start + i++) % h->size;
+		if (h->lines[slot]
+			&& hist_index_add(&h->index, h->lines[slot], h->ids[slot]))
+		{
+			hist_index_free(&h->index);
+			return ;
+		}
+	}
+	h->index.live = 1;
+}
@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 22:42:29 by mshariar          #+#    #+#             */
-/*   Updated: 2025/07/03 21:42:45 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:22:50 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,9 +18,11 @@
  *
  * Duplicates STDIN and STDOUT for restoration after redirections
  * Exits with error if duplication fails
+ * Also records the pid of the shell, which its forked children lack
  */
 void	init_shell_fds(t_shell *shell)
 {
+	shell->pid = getpid();
 	shell->saved_stdin = dup(STDIN_FILENO);
 	shell->saved_stdout = dup(STDOUT_FILENO);
 	if (shell->saved_stdin == -1 || shell->saved_stdout == -1)
@@ -78,3 +80,25 @@ char	*format_shell_prompt(t_shell *shell)
 	free(dir_display);
 	return (prompt);
 }
+
+/**
+ * put_home_path - Prints a path with the home directory shown as ~
+ * @shell: Shell structure containing environment variables
+ * @path: The path to print
+ * @fd: File descriptor to print it to
+ */
+void	put_home_path(t_shell *shell, char *path, int fd)
+{
+	char	*home;
+	size_t	len;
+
+	home = get_env_value(shell, "HOME");
+	len = ft_strlen(home);
+	if (len > 1 && ft_strncmp(path, home, len) == 0
+		&& (path[len] == '/' || !path[len]))
+	{
+		ft_putstr_fd("~", fd);
+		path += len;
+	}
+	ft_putstr_fd(path, fd);
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mem_utils.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:33:35 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:33:35 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * ft_memchr - Locates the first occurrence of a byte in a memory area
+ * @s: The memory area to search
+ * @c: The byte to look for
+ * @n: Number of bytes to search
+ *
+ * Returns a pointer to the matching byte, or NULL if it is not found.
+ */
+
+void	*ft_memchr(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+
+	p = (const unsigned char *)s;
+	while (n--)
+	{
+		if (*p == (unsigned char)c)
+			return ((void *)p);
+		p++;
+	}
+	return (NULL);
+}
+
+/**
+ * ft_memcmp - Compares two memory areas
+ * @s1: The first memory area
+ * @s2: The second memory area
+ * @n: Number of bytes to compare
+ *
+ * Returns the difference between the first differing bytes, 0 if equal.
+ */
+
+int	ft_memcmp(const void *s1, const void *s2, size_t n)
+{
+	const unsigned char	*a;
+	const unsigned char	*b;
+
+	a = (const unsigned char *)s1;
+	b = (const unsigned char *)s2;
+	while (n--)
+	{
+		if (*a != *b)
+			return (*a - *b);
+		a++;
+		b++;
+	}
+	return (0);
+}
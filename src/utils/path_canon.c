@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_canon.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:56:33 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:56:33 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * drop_component - Removes the last component of a canonical path
+ * @dst: The path being built, without a trailing slash
+ * @len: Its length, updated
+ *
+ * The root has no parent; ".." there stays at the root.
+ */
+
+static void	drop_component(char *dst, size_t *len)
+{
+	while (*len > 0 && dst[*len - 1] != '/')
+		(*len)--;
+	if (*len > 0)
+		(*len)--;
+}
+
+/**
+ * append_components - Appends the components of a path
+ * @dst: The path being built, without a trailing slash
+ * @len: Its length, updated
+ * @src: The path whose components are appended
+ *
+ * Empty and "." components are skipped and ".." drops the previous
+ * component, so runs of slashes collapse as well.
+ * Returns 0 on success, -1 if the result would not fit in PATH_MAX.
+ */
+
+static int	append_components(char *dst, size_t *len, const char *src)
+{
+	size_t	n;
+
+	while (*src)
+	{
+		while (*src == '/')
+			src++;
+		n = 0;
+		while (src[n] && src[n] != '/')
+			n++;
+		if (n == 2 && src[0] == '.' && src[1] == '.')
+			drop_component(dst, len);
+		else if (n > 0 && !(n == 1 && src[0] == '.'))
+		{
+			if (*len + n + 1 >= PATH_MAX)
+				return (-1);
+			dst[(*len)++] = '/';
+			ft_memcpy(dst + *len, src, n);
+			*len += n;
+		}
+		src += n;
+	}
+	return (0);
+}
+
+/**
+ * canon_logical_path - Builds the logical path cd -L enters
+ * @dst: Buffer of PATH_MAX bytes receiving the path
+ * @base: The current logical directory, PWD
+ * @path: The directory given to cd
+ *
+ * A relative @path is taken from @base; then ".", ".." and duplicate
+ * slashes are resolved textually in one pass, as POSIX asks of cd -L.
+ * No system call is made: symbolic links are kept as named, and ".."
+ * after one goes back to where the link was, not to its target's parent.
+ * Returns 0 on success, -1 when there is no absolute base for a relative
+ * path or the result is too long.
+ */
+
+int	canon_logical_path(char *dst, const char *base, const char *path)
+{
+	size_t	len;
+
+	len = 0;
+	if (path[0] != '/')
+	{
+		if (!base || base[0] != '/')
+			return (-1);
+		if (append_components(dst, &len, base))
+			return (-1);
+	}
+	if (append_components(dst, &len, path))
+		return (-1);
+	if (len == 0)
+		dst[len++] = '/';
+	dst[len] = '\0';
+	return (0);
+}
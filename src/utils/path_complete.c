@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_complete.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:06:46 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:09:47 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * completion_shell - Remembers the shell for readline's completion hook
+ * @shell: The shell to remember, or NULL to only query it
+ *
+ * Readline calls the hook without any context, so the shell is kept here.
+ * Returns the remembered shell.
+ */
+
+static t_shell	*completion_shell(t_shell *shell)
+{
+	static t_shell	*saved;
+
+	if (shell)
+		saved = shell;
+	return (saved);
+}
+
+/**
+ * prefix_range - Finds the indexed names starting with a prefix
+ * @t: The index, names sorted
+ * @text: The prefix
+ * @n: Set to the number of such names
+ *
+ * Those names are contiguous in the sorted index, the first one is found
+ * by binary search.
+ * Returns the position of the first name >= @text.
+ */
+
+static int	prefix_range(t_path_table *t, const char *text, int *n)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+
+	lo = 0;
+	hi = t->count;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (ft_strcmp(t->names[mid], text) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	*n = 0;
+	while (lo + *n < t->count
+		&& ft_strncmp(t->names[lo + *n], text, ft_strlen(text)) == 0)
+		(*n)++;
+	return (lo);
+}
+
+/**
+ * collect_matches - Builds readline's match list for a command prefix
+ * @t: The index
+ * @text: The prefix typed so far
+ *
+ * The common prefix of the matching names is that of the first and the
+ * last one, the index being sorted.
+ * Returns the NULL-terminated list, substitution first, or NULL.
+ */
+
+static char	**collect_matches(t_path_table *t, const char *text)
+{
+	char	**matches;
+	size_t	len;
+	int		first;
+	int		n;
+	int		i;
+
+	len = ft_strlen(text);
+	first = prefix_range(t, text, &n);
+	if (n == 0)
+		return (NULL);
+	while (t->names[first][len]
+		&& t->names[first][len] == t->names[first + n - 1][len])
+		len++;
+	matches = ft_calloc(n + 2, sizeof(char *));
+	if (!matches)
+		return (NULL);
+	matches[0] = ft_substr(t->names[first], 0, len);
+	i = 0;
+	while (n > 1 && matches[0] && i < n)
+	{
+		matches[i + 1] = ft_strdup(t->names[first + i]);
+		i++;
+	}
+	return (matches);
+}
+
+/**
+ * complete_command - Readline hook completing command names
+ * @text: The word being completed
+ * @start: Its offset in the line
+ * @end: Its end in the line
+ *
+ * Words in command position, at the start of the line or after a pipe,
+ * are completed from the PATH index; anything else, and words with a
+ * slash, get readline's filename completion.
+ * Returns the match list, or NULL to fall back to filenames.
+ */
+
+static char	**complete_command(const char *text, int start, int end)
+{
+	t_shell	*shell;
+	char	**matches;
+	int		i;
+
+	(void)end;
+	i = start - 1;
+	while (i >= 0 && (rl_line_buffer[i] == ' ' || rl_line_buffer[i] == '\t'))
+		i--;
+	shell = completion_shell(NULL);
+	if ((i >= 0 && rl_line_buffer[i] != '|') || ft_strchr(text, '/')
+		|| !shell)
+		return (NULL);
+	path_index_refresh(shell);
+	matches = NULL;
+	pthread_mutex_lock(&shell->path_index.lock);
+	if (shell->path_index.table)
+		matches = collect_matches(shell->path_index.table, text);
+	pthread_mutex_unlock(&shell->path_index.lock);
+	if (matches && !matches[0])
+		return (free(matches), NULL);
+	rl_attempted_completion_over = (matches != NULL);
+	return (matches);
+}
+
+/**
+ * install_command_completion - Sets up command name completion
+ * @shell: Shell context
+ *
+ * Hooks the completion into readline and starts indexing PATH in the
+ * background right away, so the index is usually ready by the first Tab.
+ */
+
+void	install_command_completion(t_shell *shell)
+{
+	completion_shell(shell);
+	pthread_mutex_init(&shell->path_index.lock, NULL);
+	rl_attempted_completion_function = complete_command;
+	path_index_start(shell);
+}
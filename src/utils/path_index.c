@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:06:46 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:09:47 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * add_executable - Adds a directory entry to the index if it is a command
+ * @t: The table being built
+ * @cap: Capacity of its name array, updated when it grows
+ * @fd: The directory the entry belongs to
+ * @entry: The entry, as returned by getdents64()
+ *
+ * Like a PATH lookup, symbolic links are followed and only regular files
+ * with an execute bit are kept.
+ * Returns the length of the entry, to step to the next one.
+ */
+
+static int	add_executable(t_path_table *t, int *cap, int fd,
+	struct dirent64 *entry)
+{
+	struct stat	st;
+	char		**grown;
+
+	if (entry->d_type == DT_DIR || fstatat(fd, entry->d_name, &st, 0) == -1
+		|| !S_ISREG(st.st_mode) || !(st.st_mode & 0111))
+		return (entry->d_reclen);
+	if (t->count == *cap)
+	{
+		grown = malloc(sizeof(char *) * (*cap * 2 + 256));
+		if (!grown)
+			return (entry->d_reclen);
+		if (t->count)
+			ft_memcpy(grown, t->names, sizeof(char *) * t->count);
+		free(t->names);
+		t->names = grown;
+		*cap = *cap * 2 + 256;
+	}
+	t->names[t->count] = ft_strdup(entry->d_name);
+	if (t->names[t->count])
+		t->count++;
+	return (entry->d_reclen);
+}
+
+/**
+ * scan_dir - Adds the commands of one PATH directory to the index
+ * @t: The table being built
+ * @cap: Capacity of its name array
+ * @i: Index of the directory in the table
+ *
+ * The directory is read in large batches with getdents64() and its mtime
+ * is recorded, so a later change to it is noticed.
+ */
+
+static void	scan_dir(t_path_table *t, int *cap, int i)
+{
+	long		buf[2048];
+	struct stat	st;
+	long		n;
+	long		pos;
+	int			fd;
+
+	fd = open(t->dirs[i], O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd == -1)
+		return ;
+	if (fstat(fd, &st) == 0)
+		t->mtimes[i] = st.st_mtim;
+	n = getdents64(fd, buf, sizeof(buf));
+	while (n > 0)
+	{
+		pos = 0;
+		while (pos < n)
+			pos += add_executable(t, cap, fd,
+					(struct dirent64 *)((char *)buf + pos));
+		n = getdents64(fd, buf, sizeof(buf));
+	}
+	close(fd);
+}
+
+/**
+ * unique_names - Drops the duplicates of a sorted name array
+ * @t: The table, names sorted
+ *
+ * A command found in several directories is only offered once.
+ */
+
+static void	unique_names(t_path_table *t)
+{
+	int	i;
+	int	n;
+
+	i = 0;
+	n = 0;
+	while (i < t->count)
+	{
+		if (n > 0 && ft_strcmp(t->names[n - 1], t->names[i]) == 0)
+			free(t->names[i]);
+		else
+			t->names[n++] = t->names[i];
+		i++;
+	}
+	t->count = n;
+}
+
+/**
+ * publish_table - Makes a freshly built table the current index
+ * @idx: The index
+ * @t: The new table
+ *
+ * Readers only use the table under the lock, so the previous one can be
+ * freed as soon as it has been swapped out.
+ */
+
+static void	publish_table(t_path_index *idx, t_path_table *t)
+{
+	t_path_table	*old;
+
+	pthread_mutex_lock(&idx->lock);
+	old = idx->table;
+	idx->table = t;
+	idx->pending = NULL;
+	idx->done = 1;
+	pthread_mutex_unlock(&idx->lock);
+	free_path_table(old);
+}
+
+/**
+ * build_path_index - Background thread building the command index
+ * @arg: The index, whose pending table lists the PATH directories
+ *
+ * Every directory is walked, then the names are sorted with the merge
+ * sort and deduplicated, ready for prefix queries by binary search.
+ * Returns NULL.
+ */
+
+void	*build_path_index(void *arg)
+{
+	t_path_index	*idx;
+	t_path_table	*t;
+	int				cap;
+	int				i;
+
+	idx = arg;
+	t = idx->pending;
+	cap = 0;
+	i = 0;
+	while (t->dirs[i])
+	{
+		scan_dir(t, &cap, i);
+		i++;
+	}
+	sort_strings(t->names, t->count);
+	unique_names(t);
+	publish_table(idx, t);
+	return (NULL);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_refresh.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:06:46 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 07:09:47 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * free_path_table - Frees a command index table
+ * @t: The table, or NULL
+ */
+
+void	free_path_table(t_path_table *t)
+{
+	if (!t)
+		return ;
+	while (t->count > 0)
+		free(t->names[--t->count]);
+	free(t->names);
+	free(t->dirs);
+	free(t->mtimes);
+	free(t->path);
+	free(t);
+}
+
+/**
+ * path_index_start - Starts building the command index in the background
+ * @shell: Shell context, whose PATH is indexed
+ *
+ * Nothing is started while a build is still running or PATH is unset.
+ * The prompt never waits for the thread; completion simply uses the
+ * previous index, or none, until the new one is published.
+ */
+
+void	path_index_start(t_shell *shell)
+{
+	t_path_index	*idx;
+	t_path_table	*t;
+	char			*path;
+
+	idx = &shell->path_index;
+	path = get_env_value(shell, "PATH");
+	if (idx->building || !path)
+		return ;
+	t = ft_calloc(1, sizeof(t_path_table));
+	if (!t)
+		return ;
+	t->path = ft_strdup(path);
+	t->dirs = ft_split(path, ':');
+	t->mtimes = ft_calloc(count_words_split(path, ':') + 1,
+			sizeof(struct timespec));
+	if (!t->path || !t->dirs || !t->mtimes)
+		return (free_path_table(t));
+	idx->pending = t;
+	idx->done = 0;
+	if (pthread_create(&idx->thread, NULL, build_path_index, idx) != 0)
+		return (free_path_table(t));
+	idx->owner = getpid();
+	idx->building = 1;
+}
+
+/**
+ * dirs_changed - Tells whether a PATH directory changed since indexing
+ * @t: The current table
+ *
+ * Returns 1 if a directory's mtime differs from the recorded one.
+ */
+
+static int	dirs_changed(t_path_table *t)
+{
+	struct stat	st;
+	int			i;
+
+	i = 0;
+	while (t->dirs[i])
+	{
+		if (stat(t->dirs[i], &st) == -1)
+			ft_memset(&st.st_mtim, 0, sizeof(struct timespec));
+		if (st.st_mtim.tv_sec != t->mtimes[i].tv_sec
+			|| st.st_mtim.tv_nsec != t->mtimes[i].tv_nsec)
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * path_index_refresh - Keeps the command index up to date
+ * @shell: Shell context
+ *
+ * Reaps a finished build, then starts a new one when PATH is not the
+ * one indexed or one of its directories changed. Only the directories
+ * themselves are stat()ed here, the walk happens on the thread.
+ */
+
+void	path_index_refresh(t_shell *shell)
+{
+	t_path_index	*idx;
+	char			*path;
+	int				done;
+
+	idx = &shell->path_index;
+	if (idx->building)
+	{
+		pthread_mutex_lock(&idx->lock);
+		done = idx->done;
+		pthread_mutex_unlock(&idx->lock);
+		if (!done)
+			return ;
+		pthread_join(idx->thread, NULL);
+		idx->building = 0;
+	}
+	path = get_env_value(shell, "PATH");
+	if (idx->table && path && ft_strcmp(idx->table->path, path) == 0
+		&& !dirs_changed(idx->table))
+		return ;
+	path_index_start(shell);
+}
+
+/**
+ * free_path_index - Waits for a running build and frees the index
+ * @shell: Shell context
+ *
+ * A forked child has no copy of the thread to wait for, and may even
+ * hold the lock half-taken, so it leaves the index alone.
+ */
+
+void	free_path_index(t_shell *shell)
+{
+	if (shell->path_index.owner != getpid())
+		return ;
+	if (shell->path_index.building)
+		pthread_join(shell->path_index.thread, NULL);
+	shell->path_index.building = 0;
+	free_path_table(shell->path_index.table);
+	shell->path_index.table = NULL;
+}
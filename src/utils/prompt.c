@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 18:48:15 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 18:48:15 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:47:31 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -66,6 +66,18 @@ void	display_commands(void)
 		"Display text");
 	printf("│ %s%-12s%s %-28s│\n", BOLD_GREEN, "exit [code]", RESET, \
 		"Exit the shell");
+	printf("│ %s%-12s%s %-28s│\n", BOLD_GREEN, "jobs", RESET, \
+		"List background jobs");
+	printf("│ %s%-12s%s %-28s│\n", BOLD_GREEN, "wait [id|-n]", RESET, \
+		"Wait for background jobs");
+	printf("│ %s%-12s%s %-28s│\n", BOLD_GREEN, "parallel", RESET, \
+		"Run a command per value");
+	printf("│ %s%-12s%s %-28s│\n", BOLD_GREEN, "set -o [opt]", RESET, \
+		"Show or set shell options");
+	printf("│ %s%-12s%s %-28s│\n", BOLD_GREEN, "pushd <dir>", RESET, \
+		"Push and enter a directory");
+	printf("│ %s%-12s%s %-28s│\n", BOLD_GREEN, "popd / dirs", RESET, \
+		"Pop or show directory stack");
 	printf("%s└────────────────────────────────────────┘%s\n", \
 		BOLD_WHITE, RESET);
 }
@@ -104,6 +116,10 @@ void	display_operators(void)
 		"Read input from file");
 	printf("│ %s%-12s%s %-28s│\n", BOLD_CYAN, "<< <delim>", RESET, \
 		"Read input until delimiter");
+	printf("│ %s%-12s%s %-28s│\n", BOLD_CYAN, "<cmd> &", RESET, \
+		"Run command in background");
+	printf("│ %s%-12s%s %-28s│\n", BOLD_CYAN, "time <cmd>", RESET, \
+		"Time a pipeline (-p, -j)");
 	printf("%s└────────────────────────────────────────┘%s\n", \
 		BOLD_WHITE, RESET);
 }
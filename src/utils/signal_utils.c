@@ -6,7 +6,7 @@
 /*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/26 00:07:50 by mshariar          #+#    #+#             */
-/*   Updated: 2025/06/26 00:10:56 by mshariar         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:02:33 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -64,15 +64,20 @@ void	ignore_sigint_and_wait(pid_t child_pid)
  * @return       1 if interrupted, 0 otherwise
  * 
  * Sets a special exit status (999) to mark command execution,
- * executes commands, then handles signals and restores state.
+ * executes commands, timing them after the time keyword, then handles
+ * signals and restores state.
  */
 int	safely_execute_command(t_shell *shell)
 {
 	int	old_exit_status;
 
+	trace_phase(shell, TRACE_RUN);
 	old_exit_status = g_exit_status;
 	g_exit_status = 999;
-	execute_command_sequence(shell);
+	if (shell->timing)
+		run_timed(shell);
+	else
+		execute_command_sequence(shell);
 	if (g_exit_status == 130)
 	{
 		restore_standard_fds(shell);
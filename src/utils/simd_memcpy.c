@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd_memcpy.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:33:04 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:29:32 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+#ifdef FT_SIMD
+
+/**
+ * copy_sse2 - Copies memory 16 bytes at a time
+ * @d: Destination
+ * @s: Source
+ * @n: Number of bytes
+ */
+
+static void	copy_sse2(unsigned char *d, const unsigned char *s, size_t n)
+{
+	while (n >= 16)
+	{
+		_mm_storeu_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+		d += 16;
+		s += 16;
+		n -= 16;
+	}
+	while (n--)
+		*d++ = *s++;
+}
+
+/**
+ * copy_avx2 - Copies memory 32 bytes at a time
+ * @d: Destination
+ * @s: Source
+ * @n: Number of bytes
+ *
+ * The last 31 bytes at most are left to copy_sse2, once the upper halves
+ * of the registers are cleared.
+ */
+
+SIMD_AVX2 static void	copy_avx2(unsigned char *d, const unsigned char *s,
+	size_t n)
+{
+	while (n >= 32)
+	{
+		_mm256_storeu_si256((__m256i *)d,
+			_mm256_loadu_si256((const __m256i *)s));
+		d += 32;
+		s += 32;
+		n -= 32;
+	}
+	_mm256_zeroupper();
+	copy_sse2(d, s, n);
+}
+
+/**
+ * ft_memcpy - Copies n bytes between areas that do not overlap
+ * @dest: Destination
+ * @src: Source
+ * @n: Number of bytes
+ *
+ * Returns dest.
+ */
+
+void	*ft_memcpy(void *dest, const void *src, size_t n)
+{
+	if (n >= 32 && __builtin_cpu_supports("avx2"))
+		copy_avx2(dest, src, n);
+	else
+		copy_sse2(dest, src, n);
+	return (dest);
+}
+
+#endif
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd_memset.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:33:04 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:29:32 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+#ifdef FT_SIMD
+
+/**
+ * fill_sse2 - Fills memory 16 bytes at a time
+ * @d: Destination
+ * @c: The byte to write
+ * @n: Number of bytes
+ */
+
+static void	fill_sse2(unsigned char *d, unsigned char c, size_t n)
+{
+	__m128i	v;
+
+	if (n >= 16)
+		v = _mm_shuffle_epi32(_mm_cvtsi32_si128(c * 0x01010101), 0);
+	while (n >= 16)
+	{
+		_mm_storeu_si128((__m128i *)d, v);
+		d += 16;
+		n -= 16;
+	}
+	while (n--)
+		*d++ = c;
+}
+
+/**
+ * fill_avx2 - Fills memory 32 bytes at a time
+ * @d: Destination
+ * @c: The byte to write
+ * @n: Number of bytes
+ *
+ * The last 31 bytes at most are left to fill_sse2, once the upper halves
+ * of the registers are cleared.
+ */
+
+SIMD_AVX2 static void	fill_avx2(unsigned char *d, unsigned char c, size_t n)
+{
+	__m256i	v;
+
+	v = _mm256_broadcastb_epi8(_mm_cvtsi32_si128(c));
+	while (n >= 32)
+	{
+		_mm256_storeu_si256((__m256i *)d, v);
+		d += 32;
+		n -= 32;
+	}
+	_mm256_zeroupper();
+	fill_sse2(d, c, n);
+}
+
+/**
+ * ft_memset - Fills memory with a constant byte
+ * @s: The memory area
+ * @c: The byte, converted to unsigned char
+ * @n: Number of bytes
+ *
+ * Returns s.
+ */
+
+void	*ft_memset(void *s, int c, size_t n)
+{
+	if (n >= 32 && __builtin_cpu_supports("avx2"))
+		fill_avx2(s, (unsigned char)c, n);
+	else
+		fill_sse2(s, (unsigned char)c, n);
+	return (s);
+}
+
+#endif
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd_strchr.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:33:04 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:29:32 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+#ifdef FT_SIMD
+
+/**
+ * strchr_sse2 - Finds a byte or the terminator 16 bytes at a time
+ * @s: The string
+ * @c: The byte to look for
+ *
+ * Returns a pointer to the byte, or NULL if the terminator comes first.
+ */
+
+SIMD_OVERREAD static char	*strchr_sse2(const char *s, char c)
+{
+	const __m128i	*p;
+	__m128i			v;
+	__m128i			needle;
+	unsigned int	skip;
+	unsigned int	mask;
+
+	skip = (uintptr_t)s & 15;
+	p = (const __m128i *)(s - skip);
+	needle = _mm_shuffle_epi32(_mm_cvtsi32_si128(
+				(unsigned char)c * 0x01010101), 0);
+	v = _mm_load_si128(p);
+	mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, needle),
+				_mm_cmpeq_epi8(v, _mm_setzero_si128())));
+	mask = mask >> skip << skip;
+	while (!mask)
+	{
+		v = _mm_load_si128(++p);
+		mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, needle),
+					_mm_cmpeq_epi8(v, _mm_setzero_si128())));
+	}
+	s = (const char *)p + __builtin_ctz(mask);
+	if (*s == c)
+		return ((char *)s);
+	return (NULL);
+}
+
+/**
+ * strchr_avx2 - Finds a byte or the terminator 32 bytes at a time
+ * @s: The string
+ * @c: The byte to look for
+ *
+ * The upper halves of the registers are cleared before returning.
+ * Returns a pointer to the byte, or NULL if the terminator comes first.
+ */
+
+SIMD_AVX2 SIMD_OVERREAD static char	*strchr_avx2(const char *s, char c)
+{
+	const __m256i	*p;
+	__m256i			v;
+	__m256i			needle;
+	unsigned int	skip;
+	unsigned int	mask;
+
+	skip = (uintptr_t)s & 31;
+	p = (const __m256i *)(s - skip);
+	needle = _mm256_broadcastb_epi8(_mm_cvtsi32_si128(c));
+	v = _mm256_load_si256(p);
+	mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, needle),
+				_mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+	mask = mask >> skip << skip;
+	while (!mask)
+	{
+		v = _mm256_load_si256(++p);
+		mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v,
+						needle), _mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+	}
+	_mm256_zeroupper();
+	s = (const char *)p + __builtin_ctz(mask);
+	if (*s == c)
+		return ((char *)s);
+	return (NULL);
+}
+
+/**
+ * ft_strchr - Locates the first occurrence of a character in a string
+ * @s: The string
+ * @c: The character, '\0' finds the terminator
+ *
+ * Returns a pointer to the character, or NULL if it is not found.
+ */
+
+char	*ft_strchr(const char *s, int c)
+{
+	if (__builtin_cpu_supports("avx2"))
+		return (strchr_avx2(s, (char)c));
+	return (strchr_sse2(s, (char)c));
+}
+
+#endif
@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd_strcmp.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:33:04 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:29:32 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+#ifdef FT_SIMD
+
+/**
+ * compare_sse2 - Compares two strings 16 bytes at a time
+ * @a: The first string
+ * @b: The second string
+ * @n: Largest number of bytes to compare
+ *
+ * The strings are rarely aligned alike, so loads are unaligned and
+ * only used while neither of them can cross into the next page; close
+ * to a page end the bytes are compared one by one.
+ * Returns the difference of the first differing bytes, 0 if equal.
+ */
+
+SIMD_OVERREAD static int	compare_sse2(const unsigned char *a,
+	const unsigned char *b, size_t n)
+{
+	__m128i			v;
+	unsigned int	mask;
+	size_t			step;
+
+	while (n)
+	{
+		step = 1;
+		if (n >= 16 && ((uintptr_t)a & 4095) <= 4080
+			&& ((uintptr_t)b & 4095) <= 4080)
+		{
+			v = _mm_loadu_si128((const __m128i *)a);
+			mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v,
+						_mm_loadu_si128((const __m128i *)b))) ^ 0xFFFF;
+			mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+			if (mask)
+				return (a[__builtin_ctz(mask)] - b[__builtin_ctz(mask)]);
+			step = 16;
+		}
+		else if (*a != *b || !*a)
+			return (*a - *b);
+		a += step;
+		b += step;
+		n -= step;
+	}
+	return (0);
+}
+
+/**
+ * differ_avx2 - Flags the bytes that end a comparison
+ * @a: 32 bytes of the first string
+ * @b: 32 bytes of the second string
+ *
+ * Returns a mask with a bit set for each byte that differs or is the
+ * terminator of a.
+ */
+
+SIMD_AVX2 SIMD_OVERREAD static unsigned int	differ_avx2(const unsigned char *a,
+	const unsigned char *b)
+{
+	__m256i	v;
+
+	v = _mm256_loadu_si256((const __m256i *)a);
+	return (~_mm256_movemask_epi8(_mm256_cmpeq_epi8(v,
+				_mm256_loadu_si256((const __m256i *)b)))
+		| _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+}
+
+/**
+ * compare_avx2 - Compares two strings 32 bytes at a time
+ * @a: The first string
+ * @b: The second string
+ * @n: Largest number of bytes to compare
+ *
+ * Same scheme as compare_sse2 with 32-byte loads. The upper halves of
+ * the registers are cleared on the way out, so the SSE code that runs
+ * next does not pay for a state transition.
+ * Returns the difference of the first differing bytes, 0 if equal.
+ */
+
+SIMD_AVX2 static int	compare_avx2(const unsigned char *a,
+	const unsigned char *b, size_t n)
+{
+	unsigned int	mask;
+	size_t			step;
+
+	while (n)
+	{
+		step = 1;
+		mask = (*a != *b || !*a);
+		if (n >= 32 && ((uintptr_t)a & 4095) <= 4064
+			&& ((uintptr_t)b & 4095) <= 4064)
+		{
+			mask = differ_avx2(a, b);
+			step = 32;
+		}
+		if (mask)
+			break ;
+		a += step;
+		b += step;
+		n -= step;
+	}
+	_mm256_zeroupper();
+	if (!n)
+		return (0);
+	return (a[__builtin_ctz(mask)] - b[__builtin_ctz(mask)]);
+}
+
+/**
+ * ft_strcmp - Compares two strings
+ * @s1: The first string, NULL sorts first
+ * @s2: The second string, NULL sorts first
+ *
+ * Returns a negative, zero or positive value as s1 sorts before, equal
+ * to or after s2.
+ */
+
+int	ft_strcmp(const char *s1, const char *s2)
+{
+	if (!s1)
+	{
+		if (!s2)
+			return (0);
+		return (-1);
+	}
+	if (!s2)
+		return (1);
+	if (__builtin_cpu_supports("avx2"))
+		return (compare_avx2((const unsigned char *)s1,
+				(const unsigned char *)s2, SIZE_MAX));
+	return (compare_sse2((const unsigned char *)s1,
+			(const unsigned char *)s2, SIZE_MAX));
+}
+
+/**
+ * ft_strncmp - Compares at most n bytes of two strings
+ * @s1: The first string
+ * @s2: The second string
+ * @n: Largest number of bytes to compare
+ *
+ * Most calls match a short prefix such as a variable name, which is
+ * done faster byte by byte than through the vector dispatch.
+ * Returns a negative, zero or positive value as s1 sorts before, equal
+ * to or after s2.
+ */
+
+int	ft_strncmp(const char *s1, const char *s2, size_t n)
+{
+	if (n == 0)
+		return (0);
+	if (n < 16)
+	{
+		while (--n && *s1 && *s1 == *s2)
+		{
+			s1++;
+			s2++;
+		}
+		return ((unsigned char)*s1 - (unsigned char)*s2);
+	}
+	if (__builtin_cpu_supports("avx2"))
+		return (compare_avx2((const unsigned char *)s1,
+				(const unsigned char *)s2, n));
+	return (compare_sse2((const unsigned char *)s1,
+			(const unsigned char *)s2, n));
+}
+
+#endif
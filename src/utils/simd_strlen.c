@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd_strlen.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:33:04 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 08:29:32 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+#ifdef FT_SIMD
+
+/**
+ * strlen_sse2 - Finds the terminator 16 bytes at a time
+ * @s: The string
+ *
+ * Loads are aligned, so they never cross into a page the string does
+ * not touch; the bytes in front of the string are masked out.
+ * Returns the length of the string.
+ */
+
+SIMD_OVERREAD static size_t	strlen_sse2(const char *s)
+{
+	const __m128i	*p;
+	unsigned int	skip;
+	unsigned int	mask;
+
+	skip = (uintptr_t)s & 15;
+	p = (const __m128i *)(s - skip);
+	mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(p),
+				_mm_setzero_si128()));
+	mask = mask >> skip << skip;
+	while (!mask)
+		mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(++p),
+					_mm_setzero_si128()));
+	return ((const char *)p + __builtin_ctz(mask) - s);
+}
+
+/**
+ * strlen_avx2 - Finds the terminator 32 bytes at a time
+ * @s: The string
+ *
+ * Same scheme as strlen_sse2 with 32-byte aligned loads. The upper
+ * halves of the registers are cleared before returning to SSE code.
+ * Returns the length of the string.
+ */
+
+SIMD_AVX2 SIMD_OVERREAD static size_t	strlen_avx2(const char *s)
+{
+	const __m256i	*p;
+	unsigned int	skip;
+	unsigned int	mask;
+
+	skip = (uintptr_t)s & 31;
+	p = (const __m256i *)(s - skip);
+	mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(p),
+				_mm256_setzero_si256()));
+	mask = mask >> skip << skip;
+	while (!mask)
+		mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+					_mm256_load_si256(++p), _mm256_setzero_si256()));
+	_mm256_zeroupper();
+	return ((const char *)p + __builtin_ctz(mask) - s);
+}
+
+/**
+ * ft_strlen - Computes the length of a string
+ * @s: The string, or NULL
+ *
+ * The AVX2 version is used when the CPU has it, as probed by cpuid at
+ * startup; SSE2 is always there on x86-64. Targets without SSE2 build
+ * the byte loops in string_utils.c and its neighbours instead.
+ * Returns the number of bytes before the terminator, 0 for NULL.
+ */
+
+size_t	ft_strlen(const char *s)
+{
+	if (!s)
+		return (0);
+	if (__builtin_cpu_supports("avx2"))
+		return (strlen_avx2(s));
+	return (strlen_sse2(s));
+}
+
+#endif
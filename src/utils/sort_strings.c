@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_strings.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:30:13 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:30:13 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * merge_runs - Merges two sorted runs of strings
+ * @src: The array holding both runs
+ * @dst: The array receiving the merged run
+ * @bounds: Start of the first run, start of the second, end of the second
+ */
+
+static void	merge_runs(char **src, char **dst, int bounds[3])
+{
+	int	left;
+	int	right;
+	int	out;
+
+	left = bounds[0];
+	right = bounds[1];
+	out = bounds[0];
+	while (left < bounds[1] && right < bounds[2])
+	{
+		if (ft_strcmp(src[left], src[right]) <= 0)
+			dst[out++] = src[left++];
+		else
+			dst[out++] = src[right++];
+	}
+	while (left < bounds[1])
+		dst[out++] = src[left++];
+	while (right < bounds[2])
+		dst[out++] = src[right++];
+}
+
+/**
+ * merge_pass - Merges every pair of adjacent runs of a given width
+ * @src: The array holding the runs
+ * @dst: The array receiving the merged runs
+ * @count: Number of strings
+ * @width: Width of the runs being merged
+ */
+
+static void	merge_pass(char **src, char **dst, int count, int width)
+{
+	int	bounds[3];
+
+	bounds[0] = 0;
+	while (bounds[0] < count)
+	{
+		bounds[1] = bounds[0] + width;
+		if (bounds[1] > count)
+			bounds[1] = count;
+		bounds[2] = bounds[1] + width;
+		if (bounds[2] > count)
+			bounds[2] = count;
+		merge_runs(src, dst, bounds);
+		bounds[0] = bounds[2];
+	}
+}
+
+/**
+ * insertion_sort - Sorts strings in place without extra memory
+ * @items: The array to sort
+ * @count: Number of strings
+ *
+ * Only used when the merge buffer cannot be allocated.
+ */
+
+static void	insertion_sort(char **items, int count)
+{
+	char	*key;
+	int		i;
+	int		j;
+
+	i = 1;
+	while (i < count)
+	{
+		key = items[i];
+		j = i - 1;
+		while (j >= 0 && ft_strcmp(items[j], key) > 0)
+		{
+			items[j + 1] = items[j];
+			j--;
+		}
+		items[j + 1] = key;
+		i++;
+	}
+}
+
+/**
+ * merge_sort - Runs the merge passes, doubling the run width each time
+ * @items: The array to sort
+ * @buffer: Scratch array of the same size
+ * @count: Number of strings
+ *
+ * Returns the array holding the sorted result, either items or buffer.
+ */
+
+static char	**merge_sort(char **items, char **buffer, int count)
+{
+	char	**src;
+	char	**dst;
+	char	**tmp;
+	int		width;
+
+	src = items;
+	dst = buffer;
+	width = 1;
+	while (width < count)
+	{
+		merge_pass(src, dst, count, width);
+		tmp = src;
+		src = dst;
+		dst = tmp;
+		width *= 2;
+	}
+	return (src);
+}
+
+/**
+ * sort_strings - Sorts an array of strings in byte order
+ * @items: The array to sort
+ * @count: Number of strings
+ *
+ * Bottom-up merge sort, stable and O(n log n) comparisons.
+ */
+
+void	sort_strings(char **items, int count)
+{
+	char	**buffer;
+	char	**sorted;
+
+	if (count < 2)
+		return ;
+	buffer = malloc(sizeof(char *) * count);
+	if (!buffer)
+	{
+		insertion_sort(items, count);
+		return ;
+	}
+	sorted = merge_sort(items, buffer, count);
+	if (sorted != items)
+		ft_memcpy(items, sorted, sizeof(char *) * count);
+	free(buffer);
+}
@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 16:37:26 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 16:37:26 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:40:12 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -45,65 +45,41 @@ int	count_words_split(const char *s, char c)
 }
 
 /**
- * Extract next word from string
- * Updates the index pointer to position after the word
+ * ft_split - Splits a string into the fields between separators
+ * @s: The string to split
+ * @c: The separator, runs of which are skipped
+ *
+ * The pointer table and the bytes of every field share one block: the
+ * fields follow the NULL that ends the table. Each field and its
+ * terminator take at most the field and its separator in s, so the
+ * block is sized from the length of s alone.
+ * Returns the NULL-terminated table, freed with a single free(), or
+ * NULL on allocation failure.
  */
-static char	*get_next_word(const char *s, char c, int *i)
-{
-	int		len;
-	int		start;
-	char	*word;
-
-	while (s[*i] && s[*i] == c)
-		(*i)++;
-	start = *i;
-	len = 0;
-	while (s[*i] && s[*i] != c)
-	{
-		len++;
-		(*i)++;
-	}
-	word = ft_substr(s, start, len);
-	return (word);
-}
-
-static void	free_split(char **result, int count)
-{
-	int	i;
-
-	i = 0;
-	while (i < count)
-	{
-		free(result[i]);
-		i++;
-	}
-	free(result);
-}
 
 char	**ft_split(const char *s, char c)
 {
-	int		i;
-	int		j;
-	int		word_count;
 	char	**result;
+	char	*dst;
+	int		word_count;
+	int		j;
 
 	if (!s)
 		return (NULL);
 	word_count = count_words_split(s, c);
-	result = (char **)ft_calloc(word_count + 1, sizeof(char *));
+	result = malloc(sizeof(char *) * (word_count + 1) + ft_strlen(s) + 1);
 	if (!result)
 		return (NULL);
-	i = 0;
+	dst = (char *)(result + word_count + 1);
 	j = 0;
 	while (j < word_count)
 	{
-		result[j] = get_next_word(s, c, &i);
-		if (!result[j])
-		{
-			free_split(result, j);
-			return (NULL);
-		}
-		j++;
+		while (*s == c)
+			s++;
+		result[j++] = dst;
+		while (*s && *s != c)
+			*dst++ = *s++;
+		*dst++ = '\0';
 	}
 	result[j] = NULL;
 	return (result);
@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_format.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:57:26 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 05:57:26 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * append_field - Appends the value of one TIMEFORMAT directive
+ * @buf: The buffer
+ * @c: The directive letter
+ * @t: The timing state
+ * @spec: Precision and long form flag of the directive
+ *
+ * Besides bash's %R, %U, %S and %P, %M gives the maximum resident set
+ * size in kilobytes, %w and %c the voluntary and involuntary context
+ * switches.
+ * Returns 0 on success, 1 for an unknown directive, -1 on failure.
+ */
+
+static int	append_field(t_buffer *buf, char c, t_timing *t, int spec[2])
+{
+	long	cpu;
+
+	cpu = tv_us(t->total.ru_utime) + tv_us(t->total.ru_stime);
+	if (c == 'R')
+		return (append_seconds(buf, t->real_us, spec[0], spec[1]));
+	if (c == 'U')
+		return (append_seconds(buf, tv_us(t->total.ru_utime),
+				spec[0], spec[1]));
+	if (c == 'S')
+		return (append_seconds(buf, tv_us(t->total.ru_stime),
+				spec[0], spec[1]));
+	if (c == 'P' && t->real_us)
+		return (append_seconds(buf, (long)((double)cpu * 1e8
+				/ t->real_us), 2, 0));
+	if (c == 'P')
+		return (buffer_append(buf, "0.00", 4));
+	if (c == 'M')
+		return (buffer_append_num(buf, t->total.ru_maxrss, 0));
+	if (c == 'w')
+		return (buffer_append_num(buf, t->total.ru_nvcsw, 0));
+	if (c == 'c')
+		return (buffer_append_num(buf, t->total.ru_nivcsw, 0));
+	if (c == '%')
+		return (buffer_append(buf, "%", 1));
+	return (1);
+}
+
+/**
+ * append_directive - Expands one TIMEFORMAT directive into a buffer
+ * @buf: The buffer
+ * @fmt: The format, just after the '%'
+ * @t: The timing state
+ *
+ * An unknown directive is copied as it is.
+ * Returns the number of format characters used, or -1 on failure.
+ */
+
+static int	append_directive(t_buffer *buf, const char *fmt, t_timing *t)
+{
+	int	spec[2];
+	int	i;
+	int	res;
+
+	i = 0;
+	spec[0] = 3;
+	spec[1] = 0;
+	if (ft_isdigit(fmt[i]))
+		spec[0] = fmt[i++] - '0';
+	if (spec[0] > 3)
+		spec[0] = 3;
+	if (fmt[i] == 'l' && ++i)
+		spec[1] = 1;
+	res = 1;
+	if (fmt[i])
+		res = append_field(buf, fmt[i], t, spec);
+	if (res == -1)
+		return (-1);
+	if (fmt[i])
+		i++;
+	if (res == 1 && (buffer_append(buf, "%", 1)
+			|| buffer_append(buf, fmt, i)))
+		return (-1);
+	return (i);
+}
+
+/**
+ * expand_format - Expands a TIMEFORMAT string into a buffer
+ * @buf: The buffer
+ * @fmt: The format
+ * @t: The timing state
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	expand_format(t_buffer *buf, const char *fmt, t_timing *t)
+{
+	int	i;
+	int	used;
+
+	i = 0;
+	while (fmt[i])
+	{
+		if (fmt[i] != '%')
+		{
+			if (buffer_append(buf, fmt + i++, 1))
+				return (-1);
+			continue ;
+		}
+		used = append_directive(buf, fmt + i + 1, t);
+		if (used < 0)
+			return (-1);
+		i += used + 1;
+	}
+	return (buffer_append(buf, "\n", 1));
+}
+
+/**
+ * append_stages - Appends the CPU usage of every pipeline stage
+ * @buf: The buffer
+ * @t: The timing state
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	append_stages(t_buffer *buf, t_timing *t)
+{
+	int	i;
+
+	i = -1;
+	while (++i < t->count)
+	{
+		if (buffer_append(buf, "  ", 2)
+			|| buffer_append(buf, t->names[i], ft_strlen(t->names[i]))
+			|| buffer_append(buf, "\tuser ", 6)
+			|| append_seconds(buf, tv_us(t->stages[i].ru_utime), 3, 1)
+			|| buffer_append(buf, " sys ", 5)
+			|| append_seconds(buf, tv_us(t->stages[i].ru_stime), 3, 1)
+			|| buffer_append(buf, " maxrss ", 8)
+			|| buffer_append_num(buf, t->stages[i].ru_maxrss, 0)
+			|| buffer_append(buf, "k\n", 2))
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * report_timing - Prints the times of a timed line on stderr
+ * @shell: Shell context, for TIMEFORMAT
+ * @t: The timing state
+ *
+ * The report is built in memory and written at once, so it cannot be
+ * interleaved with the output of background jobs. The default report
+ * of a pipeline also lists the usage of each of its stages; an empty
+ * TIMEFORMAT prints nothing.
+ */
+
+void	report_timing(t_shell *shell, t_timing *t)
+{
+	t_buffer	buf;
+	const char	*fmt;
+	int			stages;
+
+	if (t->format == TIME_JSON)
+		return (report_json(t));
+	fmt = get_env_value(shell, "TIMEFORMAT");
+	stages = (!fmt && t->format == TIME_DEFAULT && t->count > 1);
+	if (t->format == TIME_POSIX)
+		fmt = TIME_POSIX_FORMAT;
+	else if (!fmt)
+		fmt = TIME_DEFAULT_FORMAT;
+	if (!*fmt)
+		return ;
+	ft_memset(&buf, 0, sizeof(t_buffer));
+	if (expand_format(&buf, fmt, t) == 0
+		&& (!stages || append_stages(&buf, t) == 0))
+		write(STDERR_FILENO, buf.data, buf.len);
+	free(buf.data);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_json.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:57:27 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:02:33 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * tv_us - Converts a timeval to microseconds
+ * @tv: The time value
+ *
+ * Returns the number of microseconds.
+ */
+
+long	tv_us(struct timeval tv)
+{
+	return (tv.tv_sec * 1000000L + tv.tv_usec);
+}
+
+/**
+ * append_seconds - Appends a duration in seconds to a buffer
+ * @buf: The buffer
+ * @us: The duration in microseconds
+ * @precision: Number of decimals, 0 to 6
+ * @long_form: Nonzero for the MMmSS.FFs form
+ *
+ * Decimals are truncated, as bash does.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	append_seconds(t_buffer *buf, long us, int precision, int long_form)
+{
+	long	div;
+	int		i;
+
+	if (long_form && (buffer_append_num(buf, us / 60000000L, 0)
+			|| buffer_append(buf, "m", 1)))
+		return (-1);
+	if (long_form)
+		us %= 60000000L;
+	if (buffer_append_num(buf, us / 1000000L, 0))
+		return (-1);
+	div = 1;
+	i = precision;
+	while (i++ < 6)
+		div *= 10;
+	if (precision > 0 && (buffer_append(buf, ".", 1)
+			|| buffer_append_num(buf, us % 1000000L / div, precision)))
+		return (-1);
+	if (long_form)
+		return (buffer_append(buf, "s", 1));
+	return (0);
+}
+
+/**
+ * append_json_string - Appends a string as a JSON string literal
+ * @buf: The buffer
+ * @s: The string
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+int	append_json_string(t_buffer *buf, const char *s)
+{
+	char	esc[6];
+
+	if (buffer_append(buf, "\"", 1))
+		return (-1);
+	while (*s)
+	{
+		ft_memcpy(esc, "\\u00", 4);
+		esc[4] = "0123456789abcdef"[(unsigned char)*s >> 4];
+		esc[5] = "0123456789abcdef"[(unsigned char)*s & 15];
+		if ((*s == '"' || *s == '\\') && (buffer_append(buf, "\\", 1)
+				|| buffer_append(buf, s, 1)))
+			return (-1);
+		else if ((unsigned char)*s < 0x20 && buffer_append(buf, esc, 6))
+			return (-1);
+		else if ((unsigned char)*s >= 0x20 && *s != '"' && *s != '\\'
+			&& buffer_append(buf, s, 1))
+			return (-1);
+		s++;
+	}
+	return (buffer_append(buf, "\"", 1));
+}
+
+/**
+ * append_usage - Appends the resource usage fields of a JSON object
+ * @buf: The buffer
+ * @ru: The resource usage, CPU times in microseconds
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	append_usage(t_buffer *buf, struct rusage *ru)
+{
+	if (buffer_append(buf, ",\"user\":", 8)
+		|| append_seconds(buf, tv_us(ru->ru_utime), 6, 0)
+		|| buffer_append(buf, ",\"sys\":", 7)
+		|| append_seconds(buf, tv_us(ru->ru_stime), 6, 0)
+		|| buffer_append(buf, ",\"maxrss_kb\":", 13)
+		|| buffer_append_num(buf, ru->ru_maxrss, 0)
+		|| buffer_append(buf, ",\"nvcsw\":", 9)
+		|| buffer_append_num(buf, ru->ru_nvcsw, 0)
+		|| buffer_append(buf, ",\"nivcsw\":", 10)
+		|| buffer_append_num(buf, ru->ru_nivcsw, 0))
+		return (-1);
+	return (0);
+}
+
+/**
+ * report_json - Prints the times of a timed line as one JSON object
+ * @t: The timing state
+ *
+ * The object holds the totals and a "stages" array with the usage of
+ * each pipeline stage, on a single line of stderr so that it can be
+ * collected by scripts.
+ */
+
+void	report_json(t_timing *t)
+{
+	t_buffer	buf;
+	int			i;
+	int			res;
+
+	ft_memset(&buf, 0, sizeof(t_buffer));
+	res = buffer_append(&buf, "{\"real\":", 8)
+		|| append_seconds(&buf, t->real_us, 6, 0)
+		|| append_usage(&buf, &t->total)
+		|| buffer_append(&buf, ",\"stages\":[", 11);
+	i = -1;
+	while (!res && ++i < t->count)
+	{
+		if (i > 0)
+			res = buffer_append(&buf, ",", 1);
+		res = res || buffer_append(&buf, "{\"command\":", 11)
+			|| append_json_string(&buf, t->names[i])
+			|| append_usage(&buf, &t->stages[i])
+			|| buffer_append(&buf, "}", 1);
+	}
+	if (!res && buffer_append(&buf, "]}\n", 3) == 0)
+		write(STDERR_FILENO, buf.data, buf.len);
+	free(buf.data);
+}
@@ -6,7 +6,7 @@
 /*   By: hchowdhu <hchowdhu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/27 16:30:18 by hchowdhu          #+#    #+#             */
-/*   Updated: 2025/06/27 16:30:18 by hchowdhu         ###   ########.fr       */
+/*   Updated: 2026/10/19 05:26:55 by mshariar         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -53,7 +53,8 @@ void	clean_empty_tokens(t_token **head)
 	{
 		next = token->next;
 		if (token->type == WORD && token->value && token->value[0] == '\0'
-			&& !token->single_quote && !token->double_quote)
+			&& !token->single_quote && !token->double_quote
+			&& !token->split_field)
 			remove_useless_token(head, token);
 		token = next;
 	}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:01:23 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:01:23 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * trace_now - Reads the monotonic clock
+ *
+ * Returns the current time in nanoseconds.
+ */
+
+static long	trace_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+/**
+ * init_trace - Enables phase tracing when MINISHELL_TRACE names a file
+ * @shell: Shell context, receiving the trace state
+ *
+ * The file is opened for appending and closed on exec. A shared page
+ * lets children stamp the moment they reach execve. Tracing stays off
+ * if anything fails, so every hook costs a single test when disabled.
+ */
+
+void	init_trace(t_shell *shell)
+{
+	char	*path;
+	t_trace	*trace;
+
+	path = get_env_value(shell, "MINISHELL_TRACE");
+	if (!path || !*path)
+		return ;
+	trace = malloc(sizeof(t_trace));
+	if (!trace)
+		return ;
+	ft_memset(trace, 0, sizeof(t_trace));
+	trace->fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (trace->fd == -1)
+		return (error("MINISHELL_TRACE", path, strerror(errno)), free(trace));
+	trace->exec_at = mmap(NULL, sizeof(long), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (trace->exec_at == MAP_FAILED)
+		return ((void)close(trace->fd), free(trace));
+	*trace->exec_at = 0;
+	shell->trace = trace;
+}
+
+/**
+ * trace_phase - Marks the boundary between two phases of a command line
+ * @shell: Shell context
+ * @phase: The phase starting now
+ *
+ * The time since the previous boundary is charged to the phase that was
+ * running, so phases never overlap. Nested work restores the phase it
+ * interrupted with the returned value.
+ * Returns the phase that was running.
+ */
+
+t_trace_phase	trace_phase(t_shell *shell, t_trace_phase phase)
+{
+	t_trace_phase	prev;
+	long			now;
+
+	if (!shell->trace)
+		return (TRACE_IDLE);
+	now = trace_now();
+	prev = shell->trace->phase;
+	if (shell->trace->mark)
+		shell->trace->spent[prev] += now - shell->trace->mark;
+	shell->trace->mark = now;
+	shell->trace->phase = phase;
+	if (phase == TRACE_FORK && !shell->trace->first_fork)
+		shell->trace->first_fork = now;
+	return (prev);
+}
+
+/**
+ * trace_exec - Stamps the moment a child reaches execve
+ * @shell: Shell context inherited by the child
+ */
+
+void	trace_exec(t_shell *shell)
+{
+	if (shell->trace)
+		*shell->trace->exec_at = trace_now();
+}
+
+/**
+ * free_trace - Disables tracing and releases its resources
+ * @shell: Shell context
+ */
+
+void	free_trace(t_shell *shell)
+{
+	if (!shell->trace)
+		return ;
+	close(shell->trace->fd);
+	munmap(shell->trace->exec_at, sizeof(long));
+	free(shell->trace->command);
+	free(shell->trace);
+	shell->trace = NULL;
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_write.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mshariar <mshariar@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:01:24 by mshariar          #+#    #+#             */
+/*   Updated: 2026/10/19 06:01:24 by mshariar         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * trace_command - Starts tracing a command line
+ * @shell: Shell context
+ * @input: The line as typed, copied since tokenizing consumes it
+ *
+ * The time spent in readline up to now is kept.
+ */
+
+void	trace_command(t_shell *shell, const char *input)
+{
+	if (!shell->trace)
+		return ;
+	trace_phase(shell, TRACE_TOKENIZE);
+	free(shell->trace->command);
+	shell->trace->command = ft_strdup(input);
+	shell->trace->line++;
+}
+
+/**
+ * append_field - Appends a "key":number member to a JSON object
+ * @buf: The buffer
+ * @key: The key, with its leading comma
+ * @n: The value
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	append_field(t_buffer *buf, const char *key, long n)
+{
+	if (buffer_append(buf, key, ft_strlen(key))
+		|| buffer_append(buf, "\":", 2)
+		|| buffer_append_num(buf, n, 0))
+		return (-1);
+	return (0);
+}
+
+/**
+ * append_phases - Appends the time spent in every phase, in nanoseconds
+ * @buf: The buffer
+ * @t: The trace state
+ *
+ * exec_ns is the delay from the first fork to the last child reaching
+ * execve, as stamped by the children themselves.
+ * Returns 0 on success, -1 on allocation failure.
+ */
+
+static int	append_phases(t_buffer *buf, t_trace *t)
+{
+	static const char	*keys[TRACE_PHASES] = {NULL, ",\"readline_ns",
+		",\"tokenize_ns", ",\"syntax_ns", ",\"expand_ns", ",\"split_ns",
+		",\"heredoc_ns", ",\"run_ns", ",\"fork_ns", ",\"wait_ns"};
+	long				total;
+	long				exec;
+	int					i;
+
+	total = 0;
+	i = TRACE_IDLE;
+	while (++i < TRACE_PHASES)
+	{
+		if (append_field(buf, keys[i], t->spent[i]))
+			return (-1);
+		if (i != TRACE_READLINE)
+			total += t->spent[i];
+	}
+	exec = 0;
+	if (t->first_fork && *t->exec_at > t->first_fork)
+		exec = *t->exec_at - t->first_fork;
+	if (append_field(buf, ",\"exec_ns", exec)
+		|| append_field(buf, ",\"total_ns", total))
+		return (-1);
+	return (0);
+}
+
+/**
+ * trace_flush - Writes the trace of a finished command line
+ * @shell: Shell context
+ *
+ * One JSON object per line, written at once so that the file stays
+ * readable when several shells share it. The counters are reset for
+ * the next line.
+ */
+
+void	trace_flush(t_shell *shell)
+{
+	t_buffer	buf;
+	t_trace		*t;
+
+	t = shell->trace;
+	if (!t)
+		return ;
+	trace_phase(shell, TRACE_IDLE);
+	ft_memset(&buf, 0, sizeof(t_buffer));
+	if (t->command && append_field(&buf, "{\"line", t->line) == 0
+		&& buffer_append(&buf, ",\"command\":", 11) == 0
+		&& append_json_string(&buf, t->command) == 0
+		&& append_field(&buf, ",\"status", g_exit_status) == 0
+		&& append_phases(&buf, t) == 0 && buffer_append(&buf, "}\n", 2) == 0)
+		write(t->fd, buf.data, buf.len);
+	free(buf.data);
+	free(t->command);
+	t->command = NULL;
+	ft_memset(t->spent, 0, sizeof(t->spent));
+	t->mark = 0;
+	t->first_fork = 0;
+	*t->exec_at = 0;
+}